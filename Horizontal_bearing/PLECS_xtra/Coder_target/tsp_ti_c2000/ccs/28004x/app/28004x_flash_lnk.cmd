@@ -77,6 +77,9 @@ MEMORY
 
    // we do not utilize any RAMGS RAM, as this memory is used for page 0
    // by the "ram_lnk" configuration
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
@@ -129,4 +132,7 @@ SECTIONS
    }
    .reset           : > RESET, TYPE = DSECT /* not used, */
 
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
  }
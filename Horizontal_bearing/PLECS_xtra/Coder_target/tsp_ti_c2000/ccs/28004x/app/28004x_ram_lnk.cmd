@@ -41,6 +41,9 @@ MEMORY
    RAMLS7_RSVD   : origin = 0x00BF00, length = 0x000100  // JTAG communication buffer
 
    RAMGS3          : origin = 0x012000, length = 0x002000
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
@@ -79,5 +82,8 @@ SECTIONS
    }
 
    .reset           : > RESET, TYPE = DSECT /* not used, */
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
  }
 
@@ -42,6 +42,8 @@ typedef struct PLX_AIN_CHANNEL_PARAMS {
 	union ADCSOC0CTL_REG  ADCSOCxCTL;
     float scale;
     float offset;
+    uint16_t oversampling; // conversions per sample (1, 2, 4, 8 or 16)
+    uint16_t extraSoc; // first free SOC used for the additional conversions
 } PLX_AIN_ChannelParams_t;
 
 typedef struct PLX_AIN_OBJ
@@ -51,6 +53,9 @@ typedef struct PLX_AIN_OBJ
 	volatile uint16_t *results;
     float scale[PLX_AIN_NUM_CHANNELS];
     float offset[PLX_AIN_NUM_CHANNELS];
+    uint16_t extraSoc[PLX_AIN_NUM_CHANNELS];
+    uint16_t numExtraSocs[PLX_AIN_NUM_CHANNELS];
+    float oversamplingScale[PLX_AIN_NUM_CHANNELS]; // scale/oversampling, only used by PLX_AIN_getInOversampledF()
 } PLX_AIN_Obj_t;
 
 typedef PLX_AIN_Obj_t *PLX_AIN_Handle_t;
@@ -71,4 +76,42 @@ inline float PLX_AIN_getInF(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
     return ((float)obj->results[aChannel] * obj->scale[aChannel] + obj->offset[aChannel]);
 }
 
+inline void PLX_AIN_getFrameF(PLX_AIN_Handle_t aHandle, float *aOut, uint16_t aMask)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    volatile uint16_t *results = obj->results;
+    const float *scale = obj->scale;
+    const float *offset = obj->offset;
+
+    // aOut is indexed by channel, channels not in aMask are left untouched
+    uint16_t mask = aMask;
+    uint16_t i = 0;
+    while(mask != 0)
+    {
+        if(mask & 1)
+        {
+            aOut[i] = (float)results[i] * scale[i] + offset[i];
+        }
+        mask >>= 1;
+        i++;
+    }
+}
+
+inline float PLX_AIN_getInOversampledF(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    volatile uint16_t *extra = &obj->results[obj->extraSoc[aChannel]];
+
+    // sum over all conversions of the channel, at most 15 additional SOCs
+    uint16_t numExtra = obj->numExtraSocs[aChannel];
+    uint32_t sum = obj->results[aChannel];
+    uint16_t i;
+    PLX_ASSERT(numExtra < 16);
+    for(i=0; i<numExtra; i++)
+    {
+        sum += extra[i];
+    }
+    return ((float)sum * obj->oversamplingScale[aChannel] + obj->offset[aChannel]);
+}
+
 #endif /* PLX_AIN_IMPL_H_ */
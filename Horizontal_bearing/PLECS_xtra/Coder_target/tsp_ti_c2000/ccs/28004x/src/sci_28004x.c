@@ -30,6 +30,8 @@
 #define PLX_SCI_EIGHT_BITS 0x07
 #define PLX_SCI_PLX_SCI_LOOPBACK 0x10
 
+#define PLX_SCI_CTL1_BUFFERED 0x0073  // enable tx, rx, rx error interrupt, not in reset
+
 PLX_SCI_Handle_t PLX_SCI_init(void *aMemory, const size_t aNumBytes)
 {
 	if(aNumBytes < sizeof(PLX_SCI_Obj_t))
@@ -37,6 +39,12 @@ PLX_SCI_Handle_t PLX_SCI_init(void *aMemory, const size_t aNumBytes)
 		return((PLX_SCI_Handle_t)NULL);
 	}
 	PLX_SCI_Handle_t handle = (PLX_SCI_Handle_t)aMemory;
+	PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)handle;
+	obj->buffered = false;
+	obj->rxOverrunCount = 0;
+	obj->rxFramingErrorCount = 0;
+	obj->rxDropCount = 0;
+	obj->breakCount = 0;
 	return handle;
 }
 
@@ -83,7 +91,18 @@ bool PLX_SCI_setupPort(PLX_SCI_Handle_t aHandle, uint32_t baudrate){
     PLX_SCI_REGS_PTR->SCIFFRX.all = 0x0000;
     PLX_SCI_REGS_PTR->SCIFFCT.all = 0x00;
 
-    PLX_SCI_REGS_PTR->SCICTL1.all = 0x0033;  // relinquish SCI from reset *
+    if(obj->buffered)
+    {
+        // RX FIFO interrupt at level, TX FIFO interrupt enabled on demand
+        PLX_SCI_REGS_PTR->SCIFFTX.bit.TXFFIL = PLX_SCI_TX_FIFO_LEVEL;
+        PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFIL = PLX_SCI_RX_FIFO_LEVEL;
+        PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFIENA = 1;
+        PLX_SCI_REGS_PTR->SCICTL1.all = PLX_SCI_CTL1_BUFFERED;  // relinquish SCI from reset, rx error interrupt
+    }
+    else
+    {
+        PLX_SCI_REGS_PTR->SCICTL1.all = 0x0033;  // relinquish SCI from reset *
+    }
 
     // reset FIFO
     PLX_SCI_REGS_PTR->SCIFFTX.bit.TXFIFORESET = 1;
@@ -93,3 +112,164 @@ bool PLX_SCI_setupPort(PLX_SCI_Handle_t aHandle, uint32_t baudrate){
 
     return true;
 }
+
+void PLX_SCI_setupBuffers(PLX_SCI_Handle_t aHandle, uint16_t *aRxBuf, uint16_t aRxLen, uint16_t *aTxBuf, uint16_t aTxLen)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+
+    // ring lengths must be powers of two
+    PLX_ASSERT((aRxLen >= 2) && ((aRxLen & (aRxLen - 1)) == 0));
+    PLX_ASSERT((aTxLen >= 2) && ((aTxLen & (aTxLen - 1)) == 0));
+
+    obj->rx.buf = aRxBuf;
+    obj->rx.mask = aRxLen - 1;
+    obj->rx.head = 0;
+    obj->rx.tail = 0;
+    obj->tx.buf = aTxBuf;
+    obj->tx.mask = aTxLen - 1;
+    obj->tx.head = 0;
+    obj->tx.tail = 0;
+    obj->buffered = true;
+}
+
+#pragma CODE_SECTION(PLX_SCI_drainRxFifo, "ramfuncs")
+static void PLX_SCI_drainRxFifo(PLX_SCI_Obj_t *obj)
+{
+    uint16_t n = PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFST;
+    uint16_t head = obj->rx.head;
+    while(n > 0)
+    {
+        uint16_t c = PLX_SCI_REGS_PTR->SCIRXBUF.all;
+        n--;
+        if(c & 0x8000) // SCIFFFE
+        {
+            obj->rxFramingErrorCount++;
+            continue;
+        }
+        uint16_t next = (head + 1) & obj->rx.mask;
+        if(next == obj->rx.tail)
+        {
+            obj->rxDropCount++;  // ring full, consumer too slow
+            continue;
+        }
+        obj->rx.buf[head] = c & 0x00FF;
+        head = next;
+    }
+    obj->rx.head = head;
+
+    if(PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFOVF)
+    {
+        obj->rxOverrunCount++;
+        PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFOVRCLR = 1;
+    }
+
+    if(PLX_SCI_REGS_PTR->SCIRXST.bit.RXERROR)
+    {
+        // reception stalls until the SCI is reset
+        if(PLX_SCI_REGS_PTR->SCIRXST.bit.BRKDT)
+        {
+            obj->breakCount++;
+        }
+        PLX_SCI_REGS_PTR->SCICTL1.all = PLX_SCI_CTL1_BUFFERED & ~0x0020;
+        PLX_SCI_REGS_PTR->SCICTL1.all = PLX_SCI_CTL1_BUFFERED;
+    }
+}
+
+#pragma CODE_SECTION(PLX_SCI_fillTxFifo, "ramfuncs")
+static void PLX_SCI_fillTxFifo(PLX_SCI_Obj_t *obj)
+{
+    uint16_t space = PLX_SCI_FIFO_DEPTH - PLX_SCI_REGS_PTR->SCIFFTX.bit.TXFFST;
+    uint16_t tail = obj->tx.tail;
+    uint16_t head = obj->tx.head;
+    while((space > 0) && (tail != head))
+    {
+        PLX_SCI_REGS_PTR->SCITXBUF.all = obj->tx.buf[tail];
+        tail = (tail + 1) & obj->tx.mask;
+        space--;
+    }
+    obj->tx.tail = tail;
+
+    // keep the FIFO interrupt alive only while there is data left to send
+    PLX_SCI_REGS_PTR->SCIFFTX.bit.TXFFIENA = (tail != head);
+}
+
+#pragma CODE_SECTION(PLX_SCI_rxIsr, "ramfuncs")
+void PLX_SCI_rxIsr(PLX_SCI_Handle_t aHandle)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+    PLX_SCI_drainRxFifo(obj);
+    PLX_SCI_REGS_PTR->SCIFFRX.bit.RXFFINTCLR = 1;
+}
+
+#pragma CODE_SECTION(PLX_SCI_txIsr, "ramfuncs")
+void PLX_SCI_txIsr(PLX_SCI_Handle_t aHandle)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+    PLX_SCI_fillTxFifo(obj);
+    PLX_SCI_REGS_PTR->SCIFFTX.bit.TXFFINTCLR = 1;
+}
+
+uint16_t PLX_SCI_read(PLX_SCI_Handle_t aHandle, uint16_t *aData, uint16_t aMaxLen)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+
+    // pick up characters remaining below the RX FIFO interrupt level
+    DINT; // PLX_SCI_rxIsr() is the regular producer
+    PLX_SCI_drainRxFifo(obj);
+    EINT;
+
+    uint16_t n = 0;
+    uint16_t tail = obj->rx.tail;
+    while((n < aMaxLen) && (tail != obj->rx.head))
+    {
+        aData[n++] = obj->rx.buf[tail];
+        tail = (tail + 1) & obj->rx.mask;
+    }
+    obj->rx.tail = tail;
+    return n;
+}
+
+uint16_t PLX_SCI_write(PLX_SCI_Handle_t aHandle, const uint16_t *aData, uint16_t aLen)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+
+    uint16_t n = 0;
+    uint16_t head = obj->tx.head;
+    while(n < aLen)
+    {
+        uint16_t next = (head + 1) & obj->tx.mask;
+        if(next == obj->tx.tail)
+        {
+            break;
+        }
+        obj->tx.buf[head] = aData[n++];
+        head = next;
+    }
+    obj->tx.head = head;
+
+    if(n > 0)
+    {
+        DINT; // PLX_SCI_txIsr() is the regular consumer
+        PLX_SCI_fillTxFifo(obj);
+        EINT;
+    }
+    return n;
+}
+
+uint32_t PLX_SCI_getRxOverrunCount(PLX_SCI_Handle_t aHandle)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+    return obj->rxOverrunCount + obj->rxDropCount;
+}
+
+uint32_t PLX_SCI_getFramingErrorCount(PLX_SCI_Handle_t aHandle)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+    return obj->rxFramingErrorCount;
+}
+
+uint32_t PLX_SCI_getBreakCount(PLX_SCI_Handle_t aHandle)
+{
+    PLX_SCI_Obj_t *obj = (PLX_SCI_Obj_t *)aHandle;
+    return obj->breakCount;
+}
@@ -114,3 +114,93 @@ void PLX_SPI_putGetWords(PLX_SPI_Handle_t aHandle, uint16_t *aOutData, uint16_t
     }
 }
 
+void PLX_SPI_setupTransactions(PLX_SPI_Handle_t aHandle, const PLX_SPI_Transaction_t *aTable, uint16_t aNumTransactions)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	obj->trans = aTable;
+	obj->numTrans = aNumTransactions;
+	obj->transBusy = false;
+
+	uint16_t i;
+	for(i=0; i<aNumTransactions; i++)
+	{
+		PLX_ASSERT((aTable[i].len >= 1) && (aTable[i].len <= PLX_SPI_FIFO_DEPTH));
+		PLX_DIO_set(aTable[i].cs, true);
+	}
+}
+
+#pragma CODE_SECTION(PLX_SPI_loadTransaction, "ramfuncs")
+static void PLX_SPI_loadTransaction(PLX_SPI_Obj_t *obj)
+{
+	const PLX_SPI_Transaction_t *t = &obj->trans[obj->transIndex];
+	uint16_t *txData = &obj->transTxData[obj->transOffset];
+
+	// interrupt once the last word of this slave has been clocked in
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIL = t->len;
+	PLX_DIO_set(t->cs, false);
+
+	uint16_t i;
+	for(i=0; i<t->len; i++)
+	{
+		PLX_SPI_REGS_PTR->SPITXBUF = (txData[i] << obj->txShift);
+	}
+}
+
+#pragma CODE_SECTION(PLX_SPI_startTransactions, "ramfuncs")
+bool PLX_SPI_startTransactions(PLX_SPI_Handle_t aHandle, uint16_t *aTxData, uint16_t *aRxData)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	if(obj->transBusy || (obj->numTrans == 0))
+	{
+		return false;
+	}
+
+	PLX_SPI_resetFifos(aHandle);
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFOVFCLR = 1;
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFINTCLR = 1;
+
+	obj->transTxData = aTxData;
+	obj->transRxData = aRxData;
+	obj->transIndex = 0;
+	obj->transOffset = 0;
+	obj->transBusy = true;
+	PLX_SPI_loadTransaction(obj);
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIENA = 1;
+	return true;
+}
+
+bool PLX_SPI_transactionsBusy(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+	return obj->transBusy;
+}
+
+#pragma CODE_SECTION(PLX_SPI_transactionIsr, "ramfuncs")
+void PLX_SPI_transactionIsr(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+	const PLX_SPI_Transaction_t *t = &obj->trans[obj->transIndex];
+	uint16_t *rxData = &obj->transRxData[obj->transOffset];
+
+	uint16_t i;
+	for(i=0; i<t->len; i++)
+	{
+		rxData[i] = PLX_SPI_REGS_PTR->SPIRXBUF & obj->rxMask;
+	}
+	PLX_DIO_set(t->cs, true);
+
+	obj->transOffset += t->len;
+	obj->transIndex++;
+	if(obj->transIndex < obj->numTrans)
+	{
+		PLX_SPI_loadTransaction(obj);
+	}
+	else
+	{
+		PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIENA = 0;
+		obj->transBusy = false;
+	}
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFINTCLR = 1;
+}
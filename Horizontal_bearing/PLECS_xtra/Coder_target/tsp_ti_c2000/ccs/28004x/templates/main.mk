@@ -38,6 +38,8 @@ $(BASE_NAME)_hal.c \
 $(BASE_NAME)_main.c\
 dispatcher.c \
 power.c \
+svm.c \
+xcp.c \
 f28004x_adc.c\
 f28004x_cputimers.c\
 f28004x_defaultisr.c\
@@ -194,6 +196,12 @@ $(BIN_DIR)/dispatcher.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/dispatche
 $(BIN_DIR)/power.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/power.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/svm.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/svm.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/xcp.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/xcp.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/f28004x_adc.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/tisrc/f28004x_adc.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
@@ -116,6 +116,8 @@ void PLX_AIN_setDefaultChannelParams(PLX_AIN_ChannelParams_t *aParams)
 	aParams->ADCSOCxCTL.bit.ACQPS = 6; // minimal value, max = 64-1, S+H in ADC clocks
     aParams->scale=1.0;
     aParams->offset=0.0;
+    aParams->oversampling=1;
+    aParams->extraSoc=0;
 }
 
 void PLX_AIN_resetChannelSetup(PLX_AIN_Handle_t aHandle)
@@ -130,6 +132,54 @@ void PLX_AIN_resetChannelSetup(PLX_AIN_Handle_t aHandle)
 	}
 	obj->adc->ADCSAMPLEMODE.all = 0; // no simultaneous sampling
 	EDIS;
+
+	for(i=0; i<PLX_AIN_NUM_CHANNELS; i++)
+	{
+		obj->numExtraSocs[i] = 0;
+	}
+}
+
+static void PLX_AIN_setupOversampling(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t aSource, const PLX_AIN_ChannelParams_t *aParams)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+	PLX_ASSERT((aParams->oversampling == 1) || (aParams->oversampling == 2) || (aParams->oversampling == 4)
+	           || (aParams->oversampling == 8) || (aParams->oversampling == 16));
+	PLX_ASSERT((aParams->oversampling == 1) || ((aParams->extraSoc + aParams->oversampling - 1) <= PLX_AIN_NUM_CHANNELS));
+
+	obj->extraSoc[aChannel] = aParams->extraSoc;
+	obj->numExtraSocs[aChannel] = aParams->oversampling - 1;
+
+	// additional conversions of the same input, triggered with the primary SOC
+	int i;
+	EALLOW;
+	for(i=0; i<obj->numExtraSocs[aChannel]; i++)
+	{
+		obj->socCtrl[aParams->extraSoc + i].bit.CHSEL = aSource;
+		obj->socCtrl[aParams->extraSoc + i].bit.TRIGSEL = aParams->ADCSOCxCTL.bit.TRIGSEL;
+		obj->socCtrl[aParams->extraSoc + i].bit.ACQPS = aParams->ADCSOCxCTL.bit.ACQPS;
+	}
+	EDIS;
+}
+
+static void PLX_AIN_setupFixedPointScaling(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+    // out-of-range values are valid for the float path, only PLX_AIN_getInIQ() rejects them
+    obj->fixedPointValid[aChannel] =
+        (obj->scale[aChannel] < 128.0) && (obj->scale[aChannel] > -128.0) &&
+        (obj->offset[aChannel] < 32768.0) && (obj->offset[aChannel] > -32768.0);
+    if(obj->fixedPointValid[aChannel])
+    {
+        obj->scaleIQ[aChannel] = (int32_t)(obj->scale[aChannel] * (float)(1L << PLX_AIN_SCALE_Q));
+        obj->offsetIQ[aChannel] = (int32_t)(obj->offset[aChannel] * (float)(1L << PLX_AIN_IQ));
+    }
+    else
+    {
+        obj->scaleIQ[aChannel] = 0;
+        obj->offsetIQ[aChannel] = 0;
+    }
 }
 
 void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t aSource, const PLX_AIN_ChannelParams_t *aParams)
@@ -145,8 +195,14 @@ void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t
 	obj->socCtrl[aChannel].bit.ACQPS = aParams->ADCSOCxCTL.bit.ACQPS;
 	EDIS;
 
+	PLX_AIN_setupOversampling(aHandle, aChannel, aSource, aParams);
+
 	obj->scale[aChannel] = aParams->scale*PLX_AIN_VoltsPerAdcBit;
     obj->offset[aChannel] = aParams->offset;
+    PLX_AIN_setupFixedPointScaling(aHandle, aChannel);
+
+    // average over all conversions of this channel, single readings keep the plain scale
+    obj->oversamplingScale[aChannel] = obj->scale[aChannel]/(float)aParams->oversampling;
 }
 
 
@@ -110,6 +110,29 @@ PLX_PWM_Handle_t PLX_PWM_init(void *aMemory, const size_t aNumBytes)
 	return handle;
 }
 
+void PLX_PWM_initGroup(PLX_PWM_Group_t *aGroup)
+{
+    aGroup->numModules = 0;
+}
+
+void PLX_PWM_addToGroup(PLX_PWM_Group_t *aGroup, PLX_PWM_Handle_t aHandle)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+
+    // keep a single write per module
+    uint16_t i;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        if(aGroup->pwm[i] == obj->pwm)
+        {
+            return;
+        }
+    }
+    PLX_ASSERT(aGroup->numModules < (PLX_PWM_EPWM_MAX_PLUS_ONE-1));
+    aGroup->pwm[aGroup->numModules] = obj->pwm;
+    aGroup->numModules++;
+}
+
 void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_PWM_Params_t *aParams)
 {
 	PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
@@ -235,6 +258,10 @@ void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_
 
 	EDIS;
 	obj->sequence = 1;
+	obj->upDown = (aParams->reg.TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN);
+	obj->tbprd = aParams->reg.TBPRD;
+	obj->fullDutyCompare = obj->upDown ? (float)aParams->reg.TBPRD : (float)aParams->reg.TBPRD + 1.0;
+	PLX_PWM_updateDutyScaling(aHandle);
 }
 
 void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
@@ -244,7 +271,7 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     PLX_ASSERT(aScalingFactor > 0.0);
 
     float newTBPRD;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         newTBPRD = (float)(obj->nomTBPRD)*aScalingFactor;
@@ -262,7 +289,10 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     {
         newTBPRD = 65535.0;
     }
-    obj->pwm->TBPRD = (uint16_t)newTBPRD;
+    obj->tbprd = (uint16_t)newTBPRD;
+    obj->pwm->TBPRD = obj->tbprd;
+    obj->fullDutyCompare = obj->upDown ? (float)obj->tbprd : (float)obj->tbprd + 1.0;
+    PLX_PWM_updateDutyScaling(aHandle);
 }
 
 void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
@@ -276,25 +306,25 @@ void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
 
     uint16_t phase;
     uint16_t dir;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         if (aPhase <= 0.5)
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (aPhase) * 2);
             dir = 0;
         }
         else
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (1-aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (1-aPhase) * 2);
             dir = 1;
         }
     }
     else
     {
         // saw-tooth
-        phase = (uint16_t)(((float)obj->pwm->TBPRD+1) * (1-aPhase));
-        if(phase > obj->pwm->TBPRD)
+        phase = (uint16_t)(((float)obj->tbprd+1) * (1-aPhase));
+        if(phase > obj->tbprd)
         {
             phase = 0;
         }
@@ -303,3 +333,42 @@ void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
     obj->pwm->TBPHS.half.TBPHS = phase;
     obj->pwm->TBCTL.bit.PHSDIR = dir;
 }
+
+void PLX_PWM_setPhaseQ15(PLX_PWM_Handle_t aHandle, uint16_t aPhase)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+
+    if(aPhase >= 0x8000)
+    {
+        aPhase = 0;
+    }
+
+    uint32_t phase;
+    uint16_t dir;
+    if(obj->upDown)
+    {
+        // up-down
+        if (aPhase <= 0x4000)
+        {
+            phase = ((uint32_t)obj->tbprd * aPhase) >> 14;
+            dir = 0;
+        }
+        else
+        {
+            phase = ((uint32_t)obj->tbprd * (0x8000 - aPhase)) >> 14;
+            dir = 1;
+        }
+    }
+    else
+    {
+        // saw-tooth
+        phase = (((uint32_t)obj->tbprd+1) * (0x8000 - aPhase)) >> 15;
+        if(phase > obj->tbprd)
+        {
+            phase = 0;
+        }
+        dir = 0;
+    }
+    obj->pwm->TBPHS.half.TBPHS = (uint16_t)phase;
+    obj->pwm->TBCTL.bit.PHSDIR = dir;
+}
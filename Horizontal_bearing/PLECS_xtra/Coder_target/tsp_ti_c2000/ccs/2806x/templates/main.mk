@@ -37,6 +37,8 @@ $(BASE_NAME)_hal.c \
 $(BASE_NAME)_main.c\
 dispatcher.c \
 power.c \
+svm.c \
+xcp.c \
 F2806x_GlobalVariableDefs.c\
 F2806x_DevInit.c\
 dio_2806x.c \
@@ -169,6 +171,12 @@ $(BIN_DIR)/dispatcher.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/dispatche
 $(BIN_DIR)/power.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/power.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/svm.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/svm.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/xcp.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/xcp.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/F2806x_GlobalVariableDefs.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/tisrc/F2806x_GlobalVariableDefs.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
@@ -44,10 +44,16 @@ typedef struct PLX_AIN_OBJ
 	volatile struct ADC_REGS *adc;
     float scale[PLX_AIN_NUM_CHANNELS];
     float offset[PLX_AIN_NUM_CHANNELS];
+    int32_t scaleIQ[PLX_AIN_NUM_CHANNELS]; // Q(PLX_AIN_SCALE_Q)
+    int32_t offsetIQ[PLX_AIN_NUM_CHANNELS]; // Q(PLX_AIN_IQ)
+    bool fixedPointValid[PLX_AIN_NUM_CHANNELS]; // scale and offset fit the Q formats
 } PLX_AIN_Obj_t;
 
 typedef PLX_AIN_Obj_t *PLX_AIN_Handle_t;
 
+#define PLX_AIN_IQ 16 // Q format of fixed-point results
+#define PLX_AIN_SCALE_Q 24 // Q format of fixed-point scale factors, |scale| < 128
+
 extern void PLX_AIN_getRegisterBase(PLX_AIN_Unit_t aAdcUnit, volatile struct ADC_REGS** aReg);
 
 inline uint16_t PLX_AIN_getIn(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
@@ -120,4 +126,35 @@ inline float PLX_AIN_getInF(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
     return ((float)PLX_AIN_getIn(aHandle, aChannel) * obj->scale[aChannel] + obj->offset[aChannel]);
 }
 
+// fixed-point read path, only provided on 2806x and 2833x
+inline int32_t PLX_AIN_getInIQ(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+    PLX_ASSERT(obj->fixedPointValid[aChannel]);
+    // 32x32 multiply with 64-bit intermediate, maps to a single IQ multiply
+    return __IQmpy((long)PLX_AIN_getIn(aHandle, aChannel), obj->scaleIQ[aChannel], PLX_AIN_SCALE_Q-PLX_AIN_IQ) + obj->offsetIQ[aChannel];
+}
+
+inline void PLX_AIN_getFrameF(PLX_AIN_Handle_t aHandle, float *aOut, uint16_t aMask)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    volatile Uint16 *results = &obj->adc->ADCRESULT0; // ADCRESULT0..15 are contiguous
+    const float *scale = obj->scale;
+    const float *offset = obj->offset;
+
+    // aOut is indexed by channel, channels not in aMask are left untouched
+    uint16_t mask = aMask;
+    uint16_t i = 0;
+    while(mask != 0)
+    {
+        if(mask & 1)
+        {
+            aOut[i] = (float)(results[i] >> 4) * scale[i] + offset[i];
+        }
+        mask >>= 1;
+        i++;
+    }
+}
+
 #endif /* PLX_AIN_IMPL_H_ */
@@ -64,24 +64,54 @@ typedef struct PLX_PWM_OBJ
 	volatile struct EPWM_REGS *pwm;
 	uint16_t nomTBPRD;
     uint16_t sequence;
+    bool upDown; // carrier mode, cached at configuration
+    uint16_t tbprd; // mirror of TBPRD, avoids peripheral reads
+    float fullDutyCompare; // compare value for 100% duty at current period
+    float dutyScale; // cmp = dutyOffset + dutyScale*duty, depends on sequence
+    float dutyOffset;
 } PLX_PWM_Obj_t;
 
 typedef PLX_PWM_Obj_t *PLX_PWM_Handle_t;
 
+// modules forced/cleared together within one EALLOW window
+typedef struct PLX_PWM_GROUP
+{
+    uint16_t numModules;
+    volatile struct EPWM_REGS *pwm[PLX_PWM_EPWM_MAX_PLUS_ONE-1];
+} PLX_PWM_Group_t;
+
 extern void PLX_PWM_getRegisterBase(PLX_PWM_Unit_t aPwmChannel, volatile struct EPWM_REGS** aReg);
 
+// fixed-point variants, only provided on 2806x and 2833x
+extern void PLX_PWM_setPhaseQ15(PLX_PWM_Handle_t aHandle, uint16_t aPhase);
+
 inline uint32_t PLX_PWM_getFullDutyCompare(PLX_PWM_Handle_t aHandle)
 {
     PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
-        return obj->pwm->TBPRD;
+        return obj->tbprd;
     }
     else
     {
-        // triangle
-        return (uint32_t)obj->pwm->TBPRD+1;
+        // sawtooth
+        return (uint32_t)obj->tbprd+1;
+    }
+}
+
+inline void PLX_PWM_updateDutyScaling(PLX_PWM_Handle_t aHandle)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    if((obj->sequence & 1) == 0)
+    {
+        obj->dutyScale = -obj->fullDutyCompare;
+        obj->dutyOffset = obj->fullDutyCompare;
+    }
+    else
+    {
+        obj->dutyScale = obj->fullDutyCompare;
+        obj->dutyOffset = 0.0;
     }
 }
 
@@ -119,6 +149,28 @@ inline void PLX_PWM_disableOut(PLX_PWM_Handle_t aHandle)
 	EDIS;
 }
 
+inline void PLX_PWM_enableGroupOut(const PLX_PWM_Group_t *aGroup)
+{
+    uint16_t i;
+    EALLOW;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        aGroup->pwm[i]->TZCLR.bit.OST = 1;
+    }
+    EDIS;
+}
+
+inline void PLX_PWM_disableGroupOut(const PLX_PWM_Group_t *aGroup)
+{
+    uint16_t i;
+    EALLOW;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        aGroup->pwm[i]->TZFRC.bit.OST = 1;
+    }
+    EDIS;
+}
+
 inline void PLX_PWM_setCompare(PLX_PWM_Handle_t aHandle, uint16_t aCompare)
 {
     PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
@@ -199,6 +251,7 @@ inline void PLX_PWM_setSequence(PLX_PWM_Handle_t aHandle, uint16_t aSequence)
             PLX_ASSERT(0);
     }
     obj->sequence = aSequence;
+    PLX_PWM_updateDutyScaling(aHandle);
  }
 
 inline uint16_t PLX_PWM_getSequence(PLX_PWM_Handle_t aHandle)
@@ -207,29 +260,50 @@ inline uint16_t PLX_PWM_getSequence(PLX_PWM_Handle_t aHandle)
     return obj->sequence;
 }
 
+// compare = offset + scale*duty, for duty updates performed outside of this driver (e.g. multi-level modulator)
+inline void PLX_PWM_getDutyScaling(PLX_PWM_Handle_t aHandle, float *aOffset, float *aScale)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    *aOffset = obj->dutyOffset;
+    *aScale = obj->dutyScale;
+}
+
+inline void PLX_PWM_setDutyN(const PLX_PWM_Handle_t *aHandles, const float *aDuties, uint16_t aNum)
+{
+    uint16_t i;
+    for(i=0; i<aNum; i++)
+    {
+        PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandles[i];
+
+        // clamp and scale without branching on carrier mode or sequence
+        float duty = aDuties[i];
+        duty = (duty > 1.0) ? 1.0 : duty;
+        duty = (duty < 0.0) ? 0.0 : duty;
+        float cmpF = obj->dutyOffset + obj->dutyScale * duty;
+        cmpF = (cmpF > 65535.0) ? 65535.0 : cmpF;
+        PLX_PWM_setCompare(aHandles[i], (uint16_t)cmpF);
+    }
+}
+
 inline void PLX_PWM_setPwmDuty(PLX_PWM_Handle_t aHandle, float aDuty)
 {
-   float duty = aDuty;
-
-   if (duty > 1.0)
-   {
-      duty = 1.0;
-   }
-   else if(duty < 0.0)
-   {
-      duty = 0.0;
-   }
-
-   if((PLX_PWM_getSequence(aHandle) & 1) == 0)
-   {
-      duty = 1.0 - duty;
-   }
-
-   float cmpF = duty * (float)PLX_PWM_getFullDutyCompare(aHandle);
-   if(cmpF > 65535.0){
-       cmpF = 65535.0;
-   }
-   PLX_PWM_setCompare(aHandle, (uint16_t)cmpF);
+    PLX_PWM_setDutyN(&aHandle, &aDuty, 1);
+}
+
+// Q15 duty, 0x8000 corresponds to 100%
+inline void PLX_PWM_setPwmDutyQ15(PLX_PWM_Handle_t aHandle, uint16_t aDuty)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+
+    uint32_t full = obj->upDown ? (uint32_t)obj->tbprd : (uint32_t)obj->tbprd+1;
+    uint32_t duty = (aDuty > 0x8000) ? 0x8000 : aDuty;
+    uint32_t cmp = (full * duty) >> 15;
+    if((obj->sequence & 1) == 0)
+    {
+        cmp = full - cmp;
+    }
+    cmp = (cmp > 0xFFFF) ? 0xFFFF : cmp;
+    PLX_PWM_setCompare(aHandle, (uint16_t)cmp);
 }
 
 inline void PLX_PWM_enableAllClocks()
@@ -20,6 +20,8 @@
 #ifndef PLX_SPI_IMPL_H_
 #define PLX_SPI_IMPL_H_
 
+#include "plx_dio.h"
+
 #define PLX_SPI_FIFO_DEPTH 16
 
 typedef enum PLX_SPI_UNIT {
@@ -41,6 +43,12 @@ typedef struct PLX_SPI_PARAMS {
     bool                MASTERSLAVE; // Slave-0 Master-1
  } PLX_SPI_Params_t;
 
+// one slave access of a transaction sequence (not supported by this target)
+typedef struct PLX_SPI_TRANSACTION {
+    PLX_DIO_Handle_t cs;  // chip select, active low
+    uint16_t len;         // words, at most PLX_SPI_FIFO_DEPTH
+} PLX_SPI_Transaction_t;
+
 typedef struct PLX_SPI_OBJ {
     PLX_SPI_Unit_t unit;
 	uint32_t portHandle;
@@ -123,6 +123,26 @@ void PLX_AIN_resetChannelSetup(PLX_AIN_Handle_t aHandle)
 	EDIS;
 }
 
+static void PLX_AIN_setupFixedPointScaling(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+    // out-of-range values are valid for the float path, only PLX_AIN_getInIQ() rejects them
+    obj->fixedPointValid[aChannel] =
+        (obj->scale[aChannel] < 128.0) && (obj->scale[aChannel] > -128.0) &&
+        (obj->offset[aChannel] < 32768.0) && (obj->offset[aChannel] > -32768.0);
+    if(obj->fixedPointValid[aChannel])
+    {
+        obj->scaleIQ[aChannel] = (int32_t)(obj->scale[aChannel] * (float)(1L << PLX_AIN_SCALE_Q));
+        obj->offsetIQ[aChannel] = (int32_t)(obj->offset[aChannel] * (float)(1L << PLX_AIN_IQ));
+    }
+    else
+    {
+        obj->scaleIQ[aChannel] = 0;
+        obj->offsetIQ[aChannel] = 0;
+    }
+}
+
 void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t aSource, const PLX_AIN_ChannelParams_t *aParams)
 {
 	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
@@ -196,6 +216,7 @@ void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t
 	EDIS;
     obj->scale[aChannel] = aParams->scale*PLX_AIN_VoltsPerAdcBit;
     obj->offset[aChannel] = aParams->offset;
+    PLX_AIN_setupFixedPointScaling(aHandle, aChannel);
 }
 
 static void PLX_AIN_powerupAdc(PLX_AIN_Handle_t aHandle, const PLX_AIN_AdcParams_t *aParams)
@@ -39,6 +39,8 @@ DSP2833x_GlobalVariableDefs.c\
 DevInit_F2833x.c\
 dispatcher.c \
 power.c \
+svm.c \
+xcp.c \
 dio_2833x.c \
 sci_2833x.c \
 pwm_2833x.c \
@@ -169,6 +171,12 @@ $(BIN_DIR)/dispatcher.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/dispatche
 $(BIN_DIR)/power.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/power.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/svm.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/svm.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/xcp.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/xcp.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/DSP2833x_GlobalVariableDefs.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/tisrc/DSP2833x_GlobalVariableDefs.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
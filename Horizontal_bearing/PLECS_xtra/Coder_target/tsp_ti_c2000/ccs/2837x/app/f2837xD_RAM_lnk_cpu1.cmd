@@ -23,6 +23,7 @@ MEMORY
    RAMM0           	: origin = 0x000122, length = 0x0002DE
 
    PRAMGS      		: origin = 0x00C000, length = 0x008000
+   RAMGS15         : origin = 0x01B000, length = 0x001000     /* DMA accessible buffers */
 
    RESET           	: origin = 0x3FFFC0, length = 0x000002
 
@@ -42,11 +43,15 @@ MEMORY
 
    CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
    CPU1TOCPU2RAM   : origin = 0x03FC00, length = 0x000400
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
 {
    scope            : > PRAMGS
+   dmaram           : > RAMGS15
    step             : > PRAMGS
    dispatch         : > PRAMGS
 
@@ -79,5 +84,8 @@ SECTIONS
       .TI.ramfunc
    }
    .reset              : > RESET, TYPE = DSECT
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
 }
 
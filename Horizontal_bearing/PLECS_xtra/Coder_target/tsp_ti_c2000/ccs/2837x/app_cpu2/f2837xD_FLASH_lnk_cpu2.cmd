@@ -55,16 +55,22 @@ MEMORY
    //RAMD1           : origin = 0x00B800, length = 0x000800
    RAMD1_RSVD      : origin = 0x00BF00, length = 0x000100  // JTAG communication buffer
 
-   // we do not utilize any RAMGS RAM, as this memory is used for page 0
-   // by the "ram_lnk" configuration
+   // we do not utilize any RAMGS RAM, except for GS14 which holds the
+   // DMA buffers of this core (assigned to CPU2 by the CPU1 system
+   // configuration, GS15 holds the DMA buffers of CPU1)
+   RAMGS14          : origin = 0x01A000, length = 0x001000
 
    CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
    CPU1TOCPU2RAM   : origin = 0x03FC00, length = 0x000400
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
 {
    scope            : > RAMLS
+   dmaram           : > RAMGS14
    step             : > FLASH, ALIGN(4)
    dispatch         : > FLASH, ALIGN(4)
 
@@ -115,6 +121,9 @@ SECTIONS
       .TI.ramfunc
    }
    .reset              : > RESET, TYPE = DSECT
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
 }
 
 /*
@@ -21,6 +21,7 @@
 #define PLX_AIN_IMPL_H_
 
 #include "F2837xD_adc.h"
+#include "plx_dma.h"
 
 #define PLX_AIN_NUM_CHANNELS 16
 #define PLX_AIN_SINGLE_ENDED 1
@@ -33,6 +34,13 @@ typedef enum PLX_AIN_UNIT {
 	PLX_AIN_ADC_D
 } PLX_AIN_Unit_t;
 
+typedef enum PLX_AIN_CAPTURE_STATE {
+	PLX_AIN_CAPTURE_IDLE = 0,
+	PLX_AIN_CAPTURE_ARMED,
+	PLX_AIN_CAPTURE_TRIGGERED,
+	PLX_AIN_CAPTURE_FROZEN
+} PLX_AIN_CaptureState_t;
+
 typedef struct PLX_AIN_ADC_PARAMS {
 	union ADCINTSEL1N2_REG ADCINTSEL1N2;
 	union ADCCTL1_REG ADCCTL1;
@@ -45,6 +53,8 @@ typedef struct PLX_AIN_CHANNEL_PARAMS {
 	union ADCSOC0CTL_REG  ADCSOCxCTL;
 	float scale;
 	float offset;
+    uint16_t oversampling; // conversions per sample (1, 2, 4, 8 or 16)
+    uint16_t extraSoc; // first free SOC used for the additional conversions
 } PLX_AIN_ChannelParams_t;
 
 typedef struct PLX_AIN_OBJ
@@ -54,6 +64,19 @@ typedef struct PLX_AIN_OBJ
 	volatile uint16_t *results;
     float scale[PLX_AIN_NUM_CHANNELS];
     float offset[PLX_AIN_NUM_CHANNELS];
+    uint16_t extraSoc[PLX_AIN_NUM_CHANNELS];
+    uint16_t numExtraSocs[PLX_AIN_NUM_CHANNELS];
+    float oversamplingScale[PLX_AIN_NUM_CHANNELS]; // scale/oversampling, only used by PLX_AIN_getInOversampledF()
+    PLX_AIN_Unit_t unit;
+    // DMA capture of all SOC results into a ring buffer
+    PLX_DMA_Obj_t captureDmaObj;
+    PLX_DMA_Handle_t captureDma;
+    uint16_t captureFrameSize;
+    uint16_t captureNumFrames;
+    uint16_t capturePostTrigger;
+    uint16_t captureTriggerFrame;
+    uint16_t captureStartFrame;
+    PLX_AIN_CaptureState_t captureState;
 } PLX_AIN_Obj_t;
 
 typedef PLX_AIN_Obj_t *PLX_AIN_Handle_t;
@@ -75,4 +98,81 @@ inline float PLX_AIN_getInF(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
     return ((float)obj->results[aChannel] * obj->scale[aChannel] + obj->offset[aChannel]);
 }
 
+inline void PLX_AIN_getFrameF(PLX_AIN_Handle_t aHandle, float *aOut, uint16_t aMask)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    volatile uint16_t *results = obj->results;
+    const float *scale = obj->scale;
+    const float *offset = obj->offset;
+
+    // aOut is indexed by channel, channels not in aMask are left untouched
+    uint16_t mask = aMask;
+    uint16_t i = 0;
+    while(mask != 0)
+    {
+        if(mask & 1)
+        {
+            aOut[i] = (float)results[i] * scale[i] + offset[i];
+        }
+        mask >>= 1;
+        i++;
+    }
+}
+
+inline float PLX_AIN_getInOversampledF(PLX_AIN_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    volatile uint16_t *extra = &obj->results[obj->extraSoc[aChannel]];
+
+    // sum over all conversions of the channel, at most 15 additional SOCs
+    uint16_t numExtra = obj->numExtraSocs[aChannel];
+    uint32_t sum = obj->results[aChannel];
+    uint16_t i;
+    PLX_ASSERT(numExtra < 16);
+    for(i=0; i<numExtra; i++)
+    {
+        sum += extra[i];
+    }
+    return ((float)sum * obj->oversamplingScale[aChannel] + obj->offset[aChannel]);
+}
+
+inline uint16_t PLX_AIN_getCaptureFrame(PLX_AIN_Handle_t aHandle)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+    return PLX_DMA_getDstOffset(obj->captureDma)/obj->captureFrameSize;
+}
+
+inline void PLX_AIN_triggerCapture(PLX_AIN_Handle_t aHandle)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+    if(obj->captureState == PLX_AIN_CAPTURE_ARMED)
+    {
+        obj->captureTriggerFrame = PLX_AIN_getCaptureFrame(aHandle);
+        obj->captureState = PLX_AIN_CAPTURE_TRIGGERED;
+    }
+}
+
+inline void PLX_AIN_pollCapture(PLX_AIN_Handle_t aHandle)
+{
+    PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+    if(obj->captureState != PLX_AIN_CAPTURE_TRIGGERED)
+    {
+        return;
+    }
+
+    uint16_t frame = PLX_AIN_getCaptureFrame(aHandle);
+    uint16_t elapsed = (frame >= obj->captureTriggerFrame) ?
+        (frame - obj->captureTriggerFrame) : (frame + obj->captureNumFrames - obj->captureTriggerFrame);
+    if(elapsed >= obj->capturePostTrigger)
+    {
+        PLX_DMA_stop(obj->captureDma);
+        // the frame being written when halting may be incomplete, start after it
+        frame++;
+        obj->captureStartFrame = (frame < obj->captureNumFrames) ? frame : 0;
+        obj->captureState = PLX_AIN_CAPTURE_FROZEN;
+    }
+}
+
 #endif /* PLX_AIN_IMPL_H_ */
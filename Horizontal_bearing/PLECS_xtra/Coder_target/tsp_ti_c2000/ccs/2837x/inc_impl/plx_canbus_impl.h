@@ -41,11 +41,18 @@ typedef struct PLX_CANBUS_PARAMS {
     uint16_t sam;
     uint16_t brp;
     bool autoBusOn;
+    bool rxInterrupt; // receive via PLX_CANBUS_isr() instead of polling
 } PLX_CANBUS_Params_t;
 
 typedef struct PLX_CANBUS_OBJ
 {
     uint32_t portHandle;
+    unsigned char txLen[PLX_CANBUS_NUM_CHANNELS];
+
+    // interrupt mode: latest frame of each rx mailbox, filled by PLX_CANBUS_isr()
+    bool rxInterrupt;
+    volatile uint32_t rxNewFlags;
+    uint16_t rxData[PLX_CANBUS_NUM_CHANNELS][8];
 } PLX_CANBUS_Obj_t;
 
 typedef PLX_CANBUS_Obj_t *PLX_CANBUS_Handle_t;
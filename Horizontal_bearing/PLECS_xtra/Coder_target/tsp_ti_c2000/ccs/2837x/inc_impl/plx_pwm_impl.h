@@ -67,26 +67,55 @@ typedef struct PLX_PWM_PARAMS {
 typedef struct PLX_PWM_OBJ
 {
 	volatile struct EPWM_REGS *pwm;
+	uint16_t unit;
 	uint16_t nomTBPRD;
     uint16_t sequence;
+    bool upDown; // carrier mode, cached at configuration
+    uint16_t tbprd; // mirror of TBPRD, avoids peripheral reads
+    uint16_t polSel; // mirror of DBCTL.POLSEL
+    float fullDutyCompare; // compare value for 100% duty at current period
+    float dutyScale; // cmp = dutyOffset + dutyScale*duty, depends on sequence
+    float dutyOffset;
 } PLX_PWM_Obj_t;
 
 typedef PLX_PWM_Obj_t *PLX_PWM_Handle_t;
 
+// modules forced/cleared together within one EALLOW window
+typedef struct PLX_PWM_GROUP
+{
+    uint16_t numModules;
+    volatile struct EPWM_REGS *pwm[PLX_PWM_EPWM_MAX_PLUS_ONE-1];
+} PLX_PWM_Group_t;
+
 extern void PLX_PWM_getRegisterBase(PLX_PWM_Unit_t aPwmChannel, volatile struct EPWM_REGS** aReg);
 
 inline uint32_t PLX_PWM_getFullDutyCompare(PLX_PWM_Handle_t aHandle)
 {
-	PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    if(obj->upDown)
     {
         // up-down
-		return obj->pwm->TBPRD;
-	}
+        return obj->tbprd;
+    }
+    else
+    {
+        // sawtooth
+        return (uint32_t)obj->tbprd+1;
+    }
+}
+
+inline void PLX_PWM_updateDutyScaling(PLX_PWM_Handle_t aHandle)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    if((obj->sequence & 1) == 0)
+    {
+        obj->dutyScale = -obj->fullDutyCompare;
+        obj->dutyOffset = obj->fullDutyCompare;
+    }
     else
     {
-        // triangle
-        return (uint32_t)obj->pwm->TBPRD+1;
+        obj->dutyScale = obj->fullDutyCompare;
+        obj->dutyOffset = 0.0;
     }
 }
 
@@ -124,12 +153,47 @@ inline void PLX_PWM_disableOut(PLX_PWM_Handle_t aHandle)
 	EDIS;
 }
 
+inline void PLX_PWM_enableGroupOut(const PLX_PWM_Group_t *aGroup)
+{
+    uint16_t i;
+    EALLOW;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        aGroup->pwm[i]->TZCLR.bit.OST = 1;
+    }
+    EDIS;
+}
+
+inline void PLX_PWM_disableGroupOut(const PLX_PWM_Group_t *aGroup)
+{
+    uint16_t i;
+    EALLOW;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        aGroup->pwm[i]->TZFRC.bit.OST = 1;
+    }
+    EDIS;
+}
+
 inline void PLX_PWM_setCompare(PLX_PWM_Handle_t aHandle, uint16_t aCompare)
 {
     PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
     obj->pwm->CMPA.bit.CMPA = aCompare;
 }
 
+// global load, only provided on type-4 PWM modules
+extern void PLX_PWM_enableGlobalLoad(PLX_PWM_Handle_t aHandle, PLX_PWM_Handle_t aMaster);
+
+// transfers all values staged since the last commit at the next CTR=0,
+// for this module and all modules linked to it
+inline void PLX_PWM_commitGlobalLoad(PLX_PWM_Handle_t aMaster)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aMaster;
+    EALLOW;
+    obj->pwm->GLDCTL2.bit.OSHTLD = 1;
+    EDIS;
+}
+
 inline void PLX_PWM_setTZSafe(PLX_PWM_Handle_t aHandle, uint16_t aSafe)
 {
 	PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
@@ -156,7 +220,7 @@ inline void PLX_PWM_setOutToPassive(PLX_PWM_Handle_t aHandle)
 {
     PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
 
-    if(obj->pwm->DBCTL.bit.POLSEL == 1)
+    if(obj->polSel == DB_ACTV_LOC)
     {
         // DB_ACTV_LOC
         obj->pwm->AQCSFRC.bit.CSFA = 2; // force high
@@ -186,7 +250,7 @@ inline void PLX_PWM_prepareSetOutToXTransition(PLX_PWM_Handle_t aHandle)
     PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
 
     // Configure shadowing to allow synchronized disabling of leg through force and deadband control
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UP) //Sawtooth carrier
+    if(!obj->upDown) //Sawtooth carrier
     {
         obj->pwm->AQSFRC.bit.RLDCSF = 1;
         obj->pwm->DBCTL2.bit.LOADDBCTLMODE = 0;
@@ -194,7 +258,7 @@ inline void PLX_PWM_prepareSetOutToXTransition(PLX_PWM_Handle_t aHandle)
     else // Symmetrical carrier
     {
         // Check polarity and sequence (odd=negative, even=positive) with xor operation
-        if( (obj->pwm->DBCTL.bit.POLSEL==2) != ((obj->sequence & 0x01)==0) )
+        if( (obj->polSel==DB_ACTV_HIC) != ((obj->sequence & 0x01)==0) )
         {
             obj->pwm->AQSFRC.bit.RLDCSF = 1;
             obj->pwm->DBCTL2.bit.LOADDBCTLMODE = 1;
@@ -246,6 +310,7 @@ inline void PLX_PWM_setSequence(PLX_PWM_Handle_t aHandle, uint16_t aSequence)
             PLX_ASSERT(0);
     }
     obj->sequence = aSequence;
+    PLX_PWM_updateDutyScaling(aHandle);
  }
 
 inline uint16_t PLX_PWM_getSequence(PLX_PWM_Handle_t aHandle)
@@ -254,29 +319,34 @@ inline uint16_t PLX_PWM_getSequence(PLX_PWM_Handle_t aHandle)
     return obj->sequence;
 }
 
+// compare = offset + scale*duty, for duty updates performed outside of this driver (e.g. CLA)
+inline void PLX_PWM_getDutyScaling(PLX_PWM_Handle_t aHandle, float *aOffset, float *aScale)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    *aOffset = obj->dutyOffset;
+    *aScale = obj->dutyScale;
+}
+
+inline void PLX_PWM_setDutyN(const PLX_PWM_Handle_t *aHandles, const float *aDuties, uint16_t aNum)
+{
+    uint16_t i;
+    for(i=0; i<aNum; i++)
+    {
+        PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandles[i];
+
+        // clamp and scale without branching on carrier mode or sequence
+        float duty = aDuties[i];
+        duty = (duty > 1.0) ? 1.0 : duty;
+        duty = (duty < 0.0) ? 0.0 : duty;
+        float cmpF = obj->dutyOffset + obj->dutyScale * duty;
+        cmpF = (cmpF > 65535.0) ? 65535.0 : cmpF;
+        PLX_PWM_setCompare(aHandles[i], (uint16_t)cmpF);
+    }
+}
+
 inline void PLX_PWM_setPwmDuty(PLX_PWM_Handle_t aHandle, float aDuty)
 {
-   float duty = aDuty;
-
-   if (duty > 1.0)
-   {
-      duty = 1.0;
-   }
-   else if(duty < 0.0)
-   {
-      duty = 0.0;
-   }
-
-   if((PLX_PWM_getSequence(aHandle) & 1) == 0)
-   {
-      duty = 1.0 - duty;
-   }
-
-   float cmpF = duty * (float)PLX_PWM_getFullDutyCompare(aHandle);
-   if(cmpF > 65535.0){
-       cmpF = 65535.0;
-   }
-   PLX_PWM_setCompare(aHandle, (uint16_t)cmpF);
+    PLX_PWM_setDutyN(&aHandle, &aDuty, 1);
 }
 
 inline void PLX_PWM_enableAllClocks()
@@ -27,10 +27,28 @@ typedef enum PLX_SCI_UNIT {
     PLX_SCI_SCI_B
 } PLX_SCI_Unit_t;
 
+#define PLX_SCI_FIFO_DEPTH 16
+#define PLX_SCI_RX_FIFO_LEVEL 8   // RX interrupt when at least 8 characters are pending
+#define PLX_SCI_TX_FIFO_LEVEL 4   // TX interrupt when at most 4 characters are left
+
+typedef struct PLX_SCI_RING {
+    uint16_t *buf;
+    uint16_t mask;
+    volatile uint16_t head;  // written by producer only
+    volatile uint16_t tail;  // written by consumer only
+} PLX_SCI_Ring_t;
+
 typedef struct PLX_SCI_OBJ {
     PLX_SCI_Unit_t unit;
     uint32_t portHandle;
     uint32_t clk;
+    bool buffered;
+    PLX_SCI_Ring_t rx;
+    PLX_SCI_Ring_t tx;
+    uint32_t rxOverrunCount;
+    uint32_t rxFramingErrorCount;
+    uint32_t rxDropCount;
+    uint32_t breakCount;
 } PLX_SCI_Obj_t;
 
 typedef PLX_SCI_Obj_t *PLX_SCI_Handle_t;
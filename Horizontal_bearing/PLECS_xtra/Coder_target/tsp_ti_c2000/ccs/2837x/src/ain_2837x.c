@@ -168,6 +168,8 @@ void PLX_AIN_configure(PLX_AIN_Handle_t aHandle, PLX_AIN_Unit_t aUnit, const PLX
 	EDIS;
 
 	obj->socCtrl = (union ADCSOC0CTL_REG *)&obj->adc->ADCSOC0CTL;
+	obj->unit = aUnit;
+	obj->captureState = PLX_AIN_CAPTURE_IDLE;
 
 	EALLOW;
 	obj->adc->ADCCTL1.bit.ADCPWDNZ = 1; // power up the ADC
@@ -195,6 +197,8 @@ void PLX_AIN_setDefaultChannelParams(PLX_AIN_ChannelParams_t *aParams)
     }
     aParams->scale=1.0;
     aParams->offset=0.0;
+    aParams->oversampling=1;
+    aParams->extraSoc=0;
 }
 
 void PLX_AIN_resetChannelSetup(PLX_AIN_Handle_t aHandle)
@@ -208,6 +212,34 @@ void PLX_AIN_resetChannelSetup(PLX_AIN_Handle_t aHandle)
 		obj->socCtrl[i].bit.TRIGSEL = 0;
 	}
 	EDIS;
+
+	for(i=0; i<PLX_AIN_NUM_CHANNELS; i++)
+	{
+		obj->numExtraSocs[i] = 0;
+	}
+}
+
+static void PLX_AIN_setupOversampling(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t aSource, const PLX_AIN_ChannelParams_t *aParams)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+	PLX_ASSERT((aParams->oversampling == 1) || (aParams->oversampling == 2) || (aParams->oversampling == 4)
+	           || (aParams->oversampling == 8) || (aParams->oversampling == 16));
+	PLX_ASSERT((aParams->oversampling == 1) || ((aParams->extraSoc + aParams->oversampling - 1) <= PLX_AIN_NUM_CHANNELS));
+
+	obj->extraSoc[aChannel] = aParams->extraSoc;
+	obj->numExtraSocs[aChannel] = aParams->oversampling - 1;
+
+	// additional conversions of the same input, triggered with the primary SOC
+	int i;
+	EALLOW;
+	for(i=0; i<obj->numExtraSocs[aChannel]; i++)
+	{
+		obj->socCtrl[aParams->extraSoc + i].bit.CHSEL = aSource;
+		obj->socCtrl[aParams->extraSoc + i].bit.TRIGSEL = aParams->ADCSOCxCTL.bit.TRIGSEL;
+		obj->socCtrl[aParams->extraSoc + i].bit.ACQPS = aParams->ADCSOCxCTL.bit.ACQPS;
+	}
+	EDIS;
 }
 
 void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t aSource, const PLX_AIN_ChannelParams_t *aParams)
@@ -223,6 +255,8 @@ void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t
 	obj->socCtrl[aChannel].bit.ACQPS = aParams->ADCSOCxCTL.bit.ACQPS;
 	EDIS;
 
+	PLX_AIN_setupOversampling(aHandle, aChannel, aSource, aParams);
+
     switch(obj->adc->ADCCTL2.bit.SIGNALMODE + 1)
     {
         case PLX_AIN_SINGLE_ENDED:
@@ -234,4 +268,76 @@ void PLX_AIN_setupChannel(PLX_AIN_Handle_t aHandle, uint16_t aChannel, uint16_t
             obj->offset[aChannel] = aParams->offset + aParams->scale*PLX_AIN_VoltsOffsetAdcDiff;
             break;
     }
+
+    // average over all conversions of this channel, single readings keep the plain scale
+    obj->oversamplingScale[aChannel] = obj->scale[aChannel]/(float)aParams->oversampling;
  }
+
+void PLX_AIN_setupCapture(PLX_AIN_Handle_t aHandle, uint16_t aDmaChannel, uint16_t *aBuffer, uint16_t aNumFrames, uint16_t aFrameSize, uint16_t aPostTrigger)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+	PLX_ASSERT((aFrameSize >= 1) && (aFrameSize <= PLX_AIN_NUM_CHANNELS));
+	PLX_ASSERT(aNumFrames >= 2);
+	PLX_ASSERT(aPostTrigger < aNumFrames);
+
+	obj->captureFrameSize = aFrameSize;
+	obj->captureNumFrames = aNumFrames;
+	obj->capturePostTrigger = aPostTrigger;
+	obj->captureTriggerFrame = 0;
+	obj->captureStartFrame = 0;
+	obj->captureState = PLX_AIN_CAPTURE_IDLE;
+
+	// ADCINT2 at end of last SOC, independent of the (possibly earlier) ADCINT1
+	// used for the task interrupt, keeps pulsing since nobody clears the flag
+	EALLOW;
+	obj->adc->ADCINTSEL1N2.bit.INT2SEL = aFrameSize - 1;
+	obj->adc->ADCINTSEL1N2.bit.INT2CONT = 1;
+	obj->adc->ADCINTSEL1N2.bit.INT2E = 1;
+	EDIS;
+
+	// one burst copies all results of a frame, source wraps back to RESULT0 after each burst
+	PLX_DMA_Params_t params;
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = PLX_DMA_TRIGGER_ADCA2 + 5*(uint16_t)obj->unit;
+	params.srcAddr = obj->results;
+	params.dstAddr = aBuffer;
+	params.burstSize = aFrameSize;
+	params.transferSize = aNumFrames;
+	params.srcWrapSize = 1;
+	params.srcWrapStep = 0;
+	params.continuous = true;
+
+	obj->captureDma = PLX_DMA_init(&obj->captureDmaObj, sizeof(obj->captureDmaObj));
+	PLX_DMA_configure(obj->captureDma, aDmaChannel, &params);
+}
+
+void PLX_AIN_armCapture(PLX_AIN_Handle_t aHandle)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+
+	if(obj->captureState == PLX_AIN_CAPTURE_TRIGGERED)
+	{
+		return;
+	}
+	obj->captureState = PLX_AIN_CAPTURE_ARMED;
+	PLX_DMA_start(obj->captureDma);
+}
+
+uint16_t PLX_AIN_getCaptureState(PLX_AIN_Handle_t aHandle)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+	return (uint16_t)obj->captureState;
+}
+
+uint16_t PLX_AIN_getCaptureStartFrame(PLX_AIN_Handle_t aHandle)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+	return obj->captureStartFrame;
+}
+
+uint16_t PLX_AIN_getCaptureTriggerFrame(PLX_AIN_Handle_t aHandle)
+{
+	PLX_AIN_Obj_t *obj = (PLX_AIN_Obj_t *)aHandle;
+	return obj->captureTriggerFrame;
+}
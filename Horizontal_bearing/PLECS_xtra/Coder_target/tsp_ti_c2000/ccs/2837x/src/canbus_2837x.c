@@ -37,6 +37,15 @@ void PLX_CANBUS_configure(PLX_CANBUS_Handle_t aHandle, PLX_CANBUS_Unit_t aUnit,
 {
     PLX_CANBUS_Obj_t *obj = (PLX_CANBUS_Obj_t *)aHandle;
 
+    obj->rxInterrupt = aParams->rxInterrupt;
+    obj->rxNewFlags = 0;
+    {
+        int i;
+        for(i=0; i<PLX_CANBUS_NUM_CHANNELS; i++){
+            obj->txLen[i] = 0;
+        }
+    }
+
     asm(" eallow");
     switch(aUnit)
     {
@@ -77,6 +86,14 @@ void PLX_CANBUS_configure(PLX_CANBUS_Handle_t aHandle, PLX_CANBUS_Unit_t aUnit,
     }
 
     CAN_enableRetry(obj->portHandle);
+
+    if(obj->rxInterrupt)
+    {
+        // message objects only, no status/error interrupts
+        CAN_enableInterrupt(obj->portHandle, CAN_INT_IE0);
+        CAN_enableGlobalInterrupt(obj->portHandle, CAN_GLOBAL_INT_CANINT0);
+    }
+
     CAN_startModule(obj->portHandle); // clears INIT and CCE bits
 
     //    CAN_enableController(obj->portHandle);
@@ -86,6 +103,7 @@ void PLX_CANBUS_setupMailbox(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, boo
                          uint32_t aId, bool isExtended, unsigned char aLen)
 {
     PLX_CANBUS_Obj_t *obj = (PLX_CANBUS_Obj_t *)aHandle;
+    PLX_ASSERT(aMailBox < PLX_CANBUS_NUM_CHANNELS);
 
     CAN_MsgFrameType frame;
     uint32_t filter;
@@ -103,11 +121,16 @@ void PLX_CANBUS_setupMailbox(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, boo
 
     if(aConfigureForTransmit)
     {
+        obj->txLen[aMailBox] = aLen; // avoids reading back IF1MCTL on every send
         CAN_setupMessageObject(obj->portHandle, aMailBox, aId, frame, CAN_MSG_OBJ_TYPE_TX,
                 0, CAN_MSG_OBJ_NO_FLAGS, aLen);
     }
     else
     {
+        if(obj->rxInterrupt)
+        {
+            filter |= CAN_MSG_OBJ_RX_INT_ENABLE;
+        }
         CAN_setupMessageObject(obj->portHandle, aMailBox, aId, frame, CAN_MSG_OBJ_TYPE_RX,
                  0x1FFFFFFF, filter, aLen); // strict filtering; obj->rxLen does not seem to affect filtering!
     }
@@ -181,6 +204,24 @@ bool PLX_CANBUS_readyForTx(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox){
 bool PLX_CANBUS_getMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, unsigned char data[], unsigned char lenMax){
     PLX_CANBUS_Obj_t *obj = (PLX_CANBUS_Obj_t *)aHandle;
 
+    if(obj->rxInterrupt)
+    {
+        // no peripheral access, the frame was copied by PLX_CANBUS_isr()
+        uint32_t rxMask = (uint32_t)1U << aMailBox;
+        if((obj->rxNewFlags & rxMask) == 0)
+        {
+            return false; // no new data
+        }
+        DINT; // PLX_CANBUS_isr() may update the mailbox
+        uint16_t i;
+        for(i=0; i<lenMax; i++){
+            data[i] = obj->rxData[aMailBox][i];
+        }
+        obj->rxNewFlags &= ~rxMask;
+        EINT;
+        return true;
+    }
+
     uint32_t mask = 1 << (aMailBox-1);
     if((CAN_getNewDataFlags(obj->portHandle) &  mask) == 0) // CAN_NDAT_21
     {
@@ -203,10 +244,7 @@ bool PLX_CANBUS_getMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, unsig
 bool PLX_CANBUS_putMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, const unsigned char data[], unsigned char len){
    PLX_CANBUS_Obj_t *obj = (PLX_CANBUS_Obj_t *)aHandle;
 
-   HWREG_BP(obj->portHandle + CAN_O_IF1CMD) = ((uint32_t)CAN_IF1CMD_CONTROL | (aMailBox & CAN_IF1CMD_MSG_NUM_M));
-   uint16_t configuredLen = HWREGH(obj->portHandle + CAN_O_IF1MCTL) & CAN_IF1MCTL_DLC_M;
-
-   if(len != (unsigned char)configuredLen)
+   if(len != obj->txLen[aMailBox])
    {
        // catch here, b/c CAN_sendMessage has an ASSERT on this condition
        return false;
@@ -223,3 +261,27 @@ bool PLX_CANBUS_putMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, const
        return true;
    }
 }
+
+void PLX_CANBUS_isr(PLX_CANBUS_Handle_t aHandle){
+    PLX_CANBUS_Obj_t *obj = (PLX_CANBUS_Obj_t *)aHandle;
+
+    uint32_t cause = CAN_getInterruptCause(obj->portHandle);
+    while((cause != 0) && (cause <= 32))
+    {
+        uint16_t mbox = (uint16_t)cause & 0x1F; // message object 32 is addressed as mailbox 0
+        uint16_t temp[8] = {PLX_CANBUS_PADDING_VALUE, PLX_CANBUS_PADDING_VALUE, PLX_CANBUS_PADDING_VALUE,
+                            PLX_CANBUS_PADDING_VALUE, PLX_CANBUS_PADDING_VALUE, PLX_CANBUS_PADDING_VALUE,
+                            PLX_CANBUS_PADDING_VALUE, PLX_CANBUS_PADDING_VALUE};
+        if(CAN_readMessage(obj->portHandle, cause, &temp[0]))
+        {
+            uint16_t i;
+            for(i=0; i<8; i++){
+                obj->rxData[mbox][i] = temp[i];
+            }
+            obj->rxNewFlags |= ((uint32_t)1U << mbox);
+        }
+        CAN_clearInterruptStatus(obj->portHandle, cause);
+        cause = CAN_getInterruptCause(obj->portHandle);
+    }
+    CAN_clearGlobalInterruptStatus(obj->portHandle, CAN_GLOBAL_INT_CANINT0);
+}
@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_dma.h"
+
+#pragma diag_suppress 112 // PLX_ASSERT(0) in switch statements
+
+void PLX_DMA_sinit()
+{
+	// shared by several drivers, only the first call resets the DMA
+	if(CpuSysRegs.PCLKCR0.bit.DMA == 1)
+	{
+		return;
+	}
+	EALLOW;
+	CpuSysRegs.PCLKCR0.bit.DMA = 1;
+	DmaRegs.DMACTRL.bit.HARDRESET = 1;
+	__asm(" NOP"); // one cycle delay required after hard reset
+	DmaRegs.DEBUGCTRL.bit.FREE = 1; // keep running when halted by emulator
+	DmaRegs.PRIORITYCTRL1.bit.CH1PRIORITY = 0; // round-robin
+	EDIS;
+}
+
+PLX_DMA_Handle_t PLX_DMA_init(void *aMemory, const size_t aNumBytes)
+{
+	if(aNumBytes < sizeof(PLX_DMA_Obj_t))
+	{
+		return((PLX_DMA_Handle_t)NULL);
+	}
+	PLX_DMA_Handle_t handle = (PLX_DMA_Handle_t)aMemory;
+	return handle;
+}
+
+void PLX_DMA_setDefaultParams(PLX_DMA_Params_t *aParams)
+{
+	aParams->trigger = PLX_DMA_TRIGGER_SOFTWARE;
+	aParams->srcAddr = NULL;
+	aParams->dstAddr = NULL;
+	aParams->burstSize = 1;
+	aParams->transferSize = 1;
+	aParams->srcBurstStep = 1;
+	aParams->dstBurstStep = 1;
+	aParams->srcTransferStep = 1;
+	aParams->dstTransferStep = 1;
+	aParams->srcWrapSize = 0;
+	aParams->srcWrapStep = 0;
+	aParams->dstWrapSize = 0;
+	aParams->dstWrapStep = 0;
+	aParams->continuous = false;
+	aParams->interruptAtEnd = false;
+}
+
+void PLX_DMA_configure(PLX_DMA_Handle_t aHandle, uint16_t aChannel, const PLX_DMA_Params_t *aParams)
+{
+	PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+
+	PLX_ASSERT((aParams->burstSize >= 1) && (aParams->burstSize <= 32));
+	PLX_ASSERT(aParams->transferSize >= 1);
+
+	EALLOW;
+	switch(aChannel)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case 1:
+			obj->ch = &DmaRegs.CH1;
+			DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = aParams->trigger;
+			break;
+
+		case 2:
+			obj->ch = &DmaRegs.CH2;
+			DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2 = aParams->trigger;
+			break;
+
+		case 3:
+			obj->ch = &DmaRegs.CH3;
+			DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3 = aParams->trigger;
+			break;
+
+		case 4:
+			obj->ch = &DmaRegs.CH4;
+			DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH4 = aParams->trigger;
+			break;
+
+		case 5:
+			obj->ch = &DmaRegs.CH5;
+			DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5 = aParams->trigger;
+			break;
+
+		case 6:
+			obj->ch = &DmaRegs.CH6;
+			DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6 = aParams->trigger;
+			break;
+	}
+	obj->dstAddr = (uint32_t)aParams->dstAddr;
+
+	obj->ch->CONTROL.bit.HALT = 1;
+	obj->ch->CONTROL.bit.SOFTRESET = 1;
+
+	obj->ch->BURST_SIZE.bit.BURSTSIZE = aParams->burstSize - 1;
+	obj->ch->SRC_BURST_STEP = aParams->srcBurstStep;
+	obj->ch->DST_BURST_STEP = aParams->dstBurstStep;
+
+	obj->ch->TRANSFER_SIZE = aParams->transferSize - 1;
+	obj->ch->SRC_TRANSFER_STEP = aParams->srcTransferStep;
+	obj->ch->DST_TRANSFER_STEP = aParams->dstTransferStep;
+
+	// wrap size larger than transfer size disables wrapping
+	obj->ch->SRC_WRAP_SIZE = (aParams->srcWrapSize == 0) ? 0xFFFF : (aParams->srcWrapSize - 1);
+	obj->ch->SRC_WRAP_STEP = aParams->srcWrapStep;
+	obj->ch->DST_WRAP_SIZE = (aParams->dstWrapSize == 0) ? 0xFFFF : (aParams->dstWrapSize - 1);
+	obj->ch->DST_WRAP_STEP = aParams->dstWrapStep;
+
+	obj->ch->SRC_BEG_ADDR_SHADOW = (uint32_t)aParams->srcAddr;
+	obj->ch->SRC_ADDR_SHADOW = (uint32_t)aParams->srcAddr;
+	obj->ch->DST_BEG_ADDR_SHADOW = (uint32_t)aParams->dstAddr;
+	obj->ch->DST_ADDR_SHADOW = (uint32_t)aParams->dstAddr;
+
+	obj->ch->MODE.bit.PERINTSEL = aChannel;
+	obj->ch->MODE.bit.PERINTE = 1;
+	obj->ch->MODE.bit.ONESHOT = 0; // one burst per trigger
+	obj->ch->MODE.bit.CONTINUOUS = aParams->continuous;
+	obj->ch->MODE.bit.DATASIZE = 0; // 16-bit
+	obj->ch->MODE.bit.OVRINTE = 0;
+	obj->ch->MODE.bit.CHINTMODE = 1; // at end of transfer
+	obj->ch->MODE.bit.CHINTE = aParams->interruptAtEnd;
+
+	obj->ch->CONTROL.bit.PERINTCLR = 1;
+	obj->ch->CONTROL.bit.ERRCLR = 1;
+	EDIS;
+}
+
+void PLX_DMA_start(PLX_DMA_Handle_t aHandle)
+{
+	PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+
+	EALLOW;
+	obj->ch->CONTROL.bit.RUN = 1;
+	EDIS;
+}
+
+void PLX_DMA_stop(PLX_DMA_Handle_t aHandle)
+{
+	PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+
+	EALLOW;
+	obj->ch->CONTROL.bit.HALT = 1;
+	EDIS;
+}
@@ -148,6 +148,29 @@ PLX_PWM_Handle_t PLX_PWM_init(void *aMemory, const size_t aNumBytes)
 	return handle;
 }
 
+void PLX_PWM_initGroup(PLX_PWM_Group_t *aGroup)
+{
+    aGroup->numModules = 0;
+}
+
+void PLX_PWM_addToGroup(PLX_PWM_Group_t *aGroup, PLX_PWM_Handle_t aHandle)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+
+    // keep a single write per module
+    uint16_t i;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        if(aGroup->pwm[i] == obj->pwm)
+        {
+            return;
+        }
+    }
+    PLX_ASSERT(aGroup->numModules < (PLX_PWM_EPWM_MAX_PLUS_ONE-1));
+    aGroup->pwm[aGroup->numModules] = obj->pwm;
+    aGroup->numModules++;
+}
+
 void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_PWM_Params_t *aParams)
 {
 	PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
@@ -250,6 +273,40 @@ void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_
 
 	EDIS;
 	obj->sequence = 1;
+	obj->unit = aModulator;
+	obj->upDown = (aParams->reg.TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN);
+	obj->tbprd = aParams->reg.TBPRD;
+	obj->polSel = aParams->reg.DBCTL.bit.POLSEL;
+	obj->fullDutyCompare = obj->upDown ? (float)aParams->reg.TBPRD : (float)aParams->reg.TBPRD + 1.0;
+	PLX_PWM_updateDutyScaling(aHandle);
+}
+
+void PLX_PWM_enableGlobalLoad(PLX_PWM_Handle_t aHandle, PLX_PWM_Handle_t aMaster)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    PLX_PWM_Obj_t *master = (PLX_PWM_Obj_t *)aMaster;
+
+    EALLOW;
+    // shadow dead-time so that it is transferred with period and compare
+    obj->pwm->DBCTL.bit.SHDWDBREDMODE = 1;
+    obj->pwm->DBCTL.bit.SHDWDBFEDMODE = 1;
+
+    obj->pwm->GLDCFG.all = 0;
+    obj->pwm->GLDCFG.bit.TBPRD_TBPRDHR = 1;
+    obj->pwm->GLDCFG.bit.CMPA_CMPAHR = 1;
+    obj->pwm->GLDCFG.bit.DBRED_DBREDHR = 1;
+    obj->pwm->GLDCFG.bit.DBFED_DBFEDHR = 1;
+
+    obj->pwm->GLDCTL.bit.GLDMODE = 0; // load at CTR=0
+    obj->pwm->GLDCTL.bit.OSHTMODE = 1; // only once armed by PLX_PWM_commitGlobalLoad()
+    obj->pwm->GLDCTL.bit.GLD = 1;
+
+    // one-shot request of the master arms this module as well
+    obj->pwm->EPWMXLINK.bit.GLDCTL2LINK = master->unit - 1;
+
+    // transfer values staged during configuration
+    obj->pwm->GLDCTL2.bit.GFRCLD = 1;
+    EDIS;
 }
 
 void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
@@ -259,7 +316,7 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     PLX_ASSERT(aScalingFactor > 0.0);
 
     float newTBPRD;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         newTBPRD = (float)(obj->nomTBPRD)*aScalingFactor;
@@ -277,7 +334,10 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     {
         newTBPRD = 65535.0;
     }
-    obj->pwm->TBPRD = (uint16_t)newTBPRD;
+    obj->tbprd = (uint16_t)newTBPRD;
+    obj->pwm->TBPRD = obj->tbprd;
+    obj->fullDutyCompare = obj->upDown ? (float)obj->tbprd : (float)obj->tbprd + 1.0;
+    PLX_PWM_updateDutyScaling(aHandle);
 }
 
 void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
@@ -291,25 +351,25 @@ void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
 
     uint16_t phase;
     uint16_t dir;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         if (aPhase <= 0.5)
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (aPhase) * 2);
             dir = 0;
         }
         else
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (1-aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (1-aPhase) * 2);
             dir = 1;
         }
     }
     else
     {
         // saw-tooth
-        phase = (uint16_t)(((float)obj->pwm->TBPRD+1) * (1-aPhase));
-        if(phase > obj->pwm->TBPRD)
+        phase = (uint16_t)(((float)obj->tbprd+1) * (1-aPhase));
+        if(phase > obj->tbprd)
         {
             phase = 0;
         }
@@ -37,6 +37,8 @@ $(BASE_NAME)_hal.c \
 $(BASE_NAME)_main.c\
 dispatcher.c \
 power.c \
+svm.c \
+xcp.c \
 F2837xD_Adc.c\
 F2837xD_DefaultISR.c\
 F2837xD_DevInit.c\
@@ -50,7 +52,8 @@ dac_2837x.c \
 qep_2837x.c \
 cap_2837x.c \
 canbus_2837x.c \
-spi_2837x.c
+spi_2837x.c \
+dma_2837x.c
 
 CLA_SOURCE_FILES=\
 $(BASE_NAME)_cla.cla
@@ -185,6 +188,12 @@ $(BIN_DIR)/dispatcher.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/dispatche
 $(BIN_DIR)/power.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/power.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/svm.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/svm.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/xcp.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/xcp.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/F2837xD_Adc.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/tisrc/F2837xD_Adc.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
@@ -224,6 +233,9 @@ $(BIN_DIR)/sci_2837x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/sci_2837x.c $(
 $(BIN_DIR)/spi_2837x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/spi_2837x.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/dma_2837x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/dma_2837x.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/dac_2837x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/dac_2837x.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 						
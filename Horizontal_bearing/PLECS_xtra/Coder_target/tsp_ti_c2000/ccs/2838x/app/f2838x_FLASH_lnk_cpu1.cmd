@@ -68,12 +68,18 @@ MEMORY
 
 
    // we do not utilize any RAMGS RAM, as this memory is used for page 0
-   // by the "ram_lnk" configuration
+   // by the "ram_lnk" configuration, except for GS15 which holds the
+   // DMA buffers (LS RAM is not accessible by the DMA)
+   RAMGS15          : origin = 0x01C000, length = 0x001000
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
 {
    scope            : > RAMLS
+   dmaram           : > RAMGS15
    step             : > FLASH, ALIGN(4)
    dispatch         : > FLASH, ALIGN(4)
 
@@ -130,4 +136,7 @@ SECTIONS
    MSGRAM_CPU2_TO_CPU1 : > CPU2TOCPU1RAM, type=NOINIT
    MSGRAM_CPU_TO_CM    : > CPUTOCMRAM, type=NOINIT
    MSGRAM_CM_TO_CPU    : > CMTOCPURAM, type=NOINIT
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
 }
@@ -25,7 +25,8 @@ MEMORY
 
    RESET            : origin = 0x3FFFC0, length = 0x000002
 
-   PRAMGS           : origin = 0x00D000, length = 0x0010000
+   PRAMGS           : origin = 0x00D000, length = 0x000F000
+   RAMGS15          : origin = 0x01C000, length = 0x001000     /* DMA accessible buffers */
 
    /* Flash sectors */
 //   FLASH0           : origin = 0x080002, length = 0x003FFE  /* on-chip Flash */
@@ -66,11 +67,15 @@ MEMORY
 
    CANA_MSG_RAM     : origin = 0x049000, length = 0x000800
    CANB_MSG_RAM     : origin = 0x04B000, length = 0x000800
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
 {
    scope            : > RAMLS
+   dmaram           : > RAMGS15
    step             : > PRAMGS
    dispatch         : > PRAMGS
 
@@ -110,4 +115,7 @@ SECTIONS
    MSGRAM_CPU2_TO_CPU1 : > CPU2TOCPU1RAM, type=NOINIT
    MSGRAM_CPU_TO_CM    : > CPUTOCMRAM, type=NOINIT
    MSGRAM_CM_TO_CPU    : > CMTOCPURAM, type=NOINIT
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
 }
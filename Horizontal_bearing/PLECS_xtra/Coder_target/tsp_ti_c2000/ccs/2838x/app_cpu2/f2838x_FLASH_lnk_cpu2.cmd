@@ -67,13 +67,19 @@ MEMORY
    CANB_MSG_RAM     : origin = 0x04B000, length = 0x000800
 
 
-   // we do not utilize any RAMGS RAM, as this memory is used for page 0
-   // by the "ram_lnk" configuration
+   // we do not utilize any RAMGS RAM, except for GS14 which holds the
+   // DMA buffers of this core (assigned to CPU2 by the CPU1 system
+   // configuration, GS15 holds the DMA buffers of CPU1)
+   RAMGS14          : origin = 0x01B000, length = 0x001000
+
+   CLA1_MSGRAMLOW   : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH  : origin = 0x001500, length = 0x000080
 }
 
 SECTIONS
 {
    scope            : > RAMLS
+   dmaram           : > RAMGS14
    step             : > FLASH, ALIGN(4)
    dispatch         : > FLASH, ALIGN(4)
 
@@ -130,4 +136,7 @@ SECTIONS
    MSGRAM_CPU2_TO_CPU1 : > CPU2TOCPU1RAM, type=NOINIT
    MSGRAM_CPU_TO_CM    : > CPUTOCMRAM, type=NOINIT
    MSGRAM_CM_TO_CPU    : > CMTOCPURAM, type=NOINIT
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW, type=NOINIT
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, type=NOINIT
 }
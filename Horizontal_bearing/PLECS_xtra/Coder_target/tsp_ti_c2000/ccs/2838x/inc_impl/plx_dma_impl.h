@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef PLX_DMA_IMPL_H_
+#define PLX_DMA_IMPL_H_
+
+#include "f2838x_dma.h"
+
+#define PLX_DMA_NUM_CHANNELS 6
+
+// trigger sources (DMACHSRCSELx), see technical reference manual
+#define PLX_DMA_TRIGGER_SOFTWARE 0
+#define PLX_DMA_TRIGGER_ADCA1 1
+#define PLX_DMA_TRIGGER_ADCA2 2
+#define PLX_DMA_TRIGGER_ADCB1 6
+#define PLX_DMA_TRIGGER_ADCC1 11
+#define PLX_DMA_TRIGGER_ADCD1 16
+#define PLX_DMA_TRIGGER_EPWM_SOCA(unit) (36 + 2*((unit) - 1))
+#define PLX_DMA_TRIGGER_EPWM_SOCB(unit) (37 + 2*((unit) - 1))
+#define PLX_DMA_TRIGGER_TINT0 68
+#define PLX_DMA_TRIGGER_TINT1 69
+#define PLX_DMA_TRIGGER_TINT2 70
+#define PLX_DMA_TRIGGER_SD1FLT1 95 // SD1FLT1..4, SD2FLT1..4 consecutive
+#define PLX_DMA_TRIGGER_SPIA_TX 109
+#define PLX_DMA_TRIGGER_SPIA_RX 110
+#define PLX_DMA_TRIGGER_SPIB_TX 111
+#define PLX_DMA_TRIGGER_SPIB_RX 112
+#define PLX_DMA_TRIGGER_SPIC_TX 113
+#define PLX_DMA_TRIGGER_SPIC_RX 114
+#define PLX_DMA_TRIGGER_SPID_TX 115
+#define PLX_DMA_TRIGGER_SPID_RX 116
+#define PLX_DMA_TRIGGER_FSIRXA 125
+#define PLX_DMA_TRIGGER_FSIRXB 157
+#define PLX_DMA_TRIGGER_FSIRXC 143 // FSIRXC..H consecutive
+
+/* Note:
+ * Sizes are given as number of 16-bit words (burst) and number of bursts
+ * (transfer, wrap), i.e. the register values plus one.
+ */
+typedef struct PLX_DMA_PARAMS {
+    uint16_t trigger;
+    volatile uint16_t *srcAddr;
+    volatile uint16_t *dstAddr;
+    uint16_t burstSize;
+    uint16_t transferSize;
+    int16_t srcBurstStep;
+    int16_t dstBurstStep;
+    int16_t srcTransferStep;
+    int16_t dstTransferStep;
+    uint16_t srcWrapSize; // 0: no wrapping
+    int16_t srcWrapStep;
+    uint16_t dstWrapSize; // 0: no wrapping
+    int16_t dstWrapStep;
+    bool continuous; // restart automatically at end of transfer
+    bool interruptAtEnd; // channel interrupt (PIE group 7) at end of each transfer
+} PLX_DMA_Params_t;
+
+typedef struct PLX_DMA_OBJ {
+    volatile struct CH_REGS *ch;
+    uint32_t dstAddr;
+} PLX_DMA_Obj_t;
+
+typedef PLX_DMA_Obj_t *PLX_DMA_Handle_t;
+
+inline uint16_t PLX_DMA_getDstOffset(PLX_DMA_Handle_t aHandle)
+{
+    PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+    return (uint16_t)(obj->ch->DST_ADDR_ACTIVE - obj->dstAddr);
+}
+
+// destination of the next transfer (taken over at its start)
+inline void PLX_DMA_setNextDstAddr(PLX_DMA_Handle_t aHandle, volatile uint16_t *aDstAddr)
+{
+    PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+
+    EALLOW;
+    obj->ch->DST_BEG_ADDR_SHADOW = (uint32_t)aDstAddr;
+    obj->ch->DST_ADDR_SHADOW = (uint32_t)aDstAddr;
+    EDIS;
+}
+
+inline bool PLX_DMA_isRunning(PLX_DMA_Handle_t aHandle)
+{
+    PLX_DMA_Obj_t *obj = (PLX_DMA_Obj_t *)aHandle;
+    return (obj->ch->CONTROL.bit.RUNSTS != 0);
+}
+
+#endif /* PLX_DMA_IMPL_H_ */
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef PLX_FSI_IMPL_H_
+#define PLX_FSI_IMPL_H_
+
+#include "f2838x_fsi.h"
+#include "plx_dma.h"
+
+#define PLX_FSI_BUF_SIZE 16 // words of the circular TX/RX buffers
+
+typedef enum PLX_FSI_PORT {
+    PLX_FSI_TX_A = 0,
+    PLX_FSI_TX_B,
+    PLX_FSI_RX_A,
+    PLX_FSI_RX_B,
+    PLX_FSI_RX_C,
+    PLX_FSI_RX_D,
+    PLX_FSI_RX_E,
+    PLX_FSI_RX_F,
+    PLX_FSI_RX_G,
+    PLX_FSI_RX_H
+} PLX_FSI_Port_t;
+
+/* Note:
+ * Ping period and timeout are given in SYSCLK cycles, zero disables them.
+ * The FSI clock equals SYSCLK/(2*prescale), data is transferred on both edges.
+ */
+typedef struct PLX_FSI_PARAMS {
+    uint16_t numWords;     // data words per frame (1..16)
+    uint16_t numLanes;     // data lines (1 or 2)
+    uint16_t prescale;     // transmitter only
+    uint16_t tag;          // frame tag of data frames (0..15)
+    uint32_t pingPeriod;   // transmitter: ping frame after this idle time
+    uint32_t pingTimeout;  // receiver: link loss after this time without frames
+} PLX_FSI_Params_t;
+
+typedef struct PLX_FSI_OBJ {
+    PLX_FSI_Port_t port;
+    volatile struct FSI_TX_REGS *tx;
+    volatile struct FSI_RX_REGS *rx;
+    uint16_t numWords;
+    uint16_t tag;
+    uint16_t seq;
+    bool seqValid;
+    bool txPending;
+    bool linkUp;
+    uint32_t frameCount;
+    uint32_t lostFrameCount;
+    uint32_t pingCount;
+    uint32_t pingTimeoutCount;
+    uint32_t crcErrorCount;
+    uint32_t frameErrorCount;
+    uint32_t overrunCount;
+    // DMA receive frames
+    PLX_DMA_Obj_t dmaObj;
+    PLX_DMA_Handle_t dma;
+    uint16_t dmaChannel;
+    uint16_t *dmaRxFrames;
+    uint16_t dmaRxBank;
+} PLX_FSI_Obj_t;
+
+typedef PLX_FSI_Obj_t *PLX_FSI_Handle_t;
+
+inline void PLX_FSI_sinit(){}
+
+inline bool PLX_FSI_isLinkUp(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->linkUp;
+}
+
+inline uint32_t PLX_FSI_getFrameCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->frameCount;
+}
+
+// derived from the sequence numbers, not available with DMA receive frames
+inline uint32_t PLX_FSI_getLostFrameCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->lostFrameCount;
+}
+
+inline uint32_t PLX_FSI_getPingCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->pingCount;
+}
+
+inline uint32_t PLX_FSI_getPingTimeoutCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->pingTimeoutCount;
+}
+
+inline uint32_t PLX_FSI_getCrcErrorCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->crcErrorCount;
+}
+
+inline uint32_t PLX_FSI_getFrameErrorCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->frameErrorCount;
+}
+
+inline uint32_t PLX_FSI_getOverrunCount(PLX_FSI_Handle_t aHandle)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+    return obj->overrunCount;
+}
+
+inline bool PLX_FSI_getDmaRxFrame(PLX_FSI_Handle_t aHandle, uint16_t **aFrame)
+{
+    PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+
+    // same bank logic as PLX_SPI_getDmaRxFrame(), the destination wraps every two frames
+    uint16_t offset = PLX_DMA_getDstOffset(obj->dma);
+    uint16_t bank = ((offset >= obj->numWords) && (offset < 2*obj->numWords)) ? 0 : 1;
+
+    *aFrame = &obj->dmaRxFrames[bank*obj->numWords];
+    if(bank == obj->dmaRxBank)
+    {
+        return false;
+    }
+    obj->dmaRxBank = bank;
+    obj->frameCount++;
+    return true;
+}
+
+#endif /* PLX_FSI_IMPL_H_ */
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef PLX_I2C_IMPL_H_
+#define PLX_I2C_IMPL_H_
+
+#include "f2838x_i2c.h"
+
+#define PLX_I2C_FIFO_DEPTH 16  // maximal number of bytes per write or read phase
+#define PLX_I2C_QUEUE_SIZE 8   // must be a power of 2
+
+typedef enum PLX_I2C_UNIT {
+    PLX_I2C_I2C_A = 0,
+    PLX_I2C_I2C_B
+} PLX_I2C_Unit_t;
+
+typedef enum PLX_I2C_STATUS {
+    PLX_I2C_IDLE = 0,
+    PLX_I2C_QUEUED,
+    PLX_I2C_ACTIVE,
+    PLX_I2C_DONE,
+    PLX_I2C_NACK,
+    PLX_I2C_ARBITRATION_LOST,
+    PLX_I2C_TIMEOUT
+} PLX_I2C_Status_t;
+
+typedef struct PLX_I2C_PARAMS {
+    uint32_t bitRate;
+    uint32_t timeoutTicks;  // CPU timer 2 counts without bus progress, 0 to disable
+} PLX_I2C_Params_t;
+
+// write phase followed by a read phase after a repeated start, either may be empty
+typedef struct PLX_I2C_TRANSACTION {
+    uint16_t address;       // 7-bit slave address
+    const uint16_t *txData; // one byte per word
+    uint16_t txLen;
+    uint16_t *rxData;       // written by PLX_I2C_isr()
+    uint16_t rxLen;
+    volatile PLX_I2C_Status_t status;
+} PLX_I2C_Transaction_t;
+
+typedef struct PLX_I2C_OBJ {
+    volatile struct I2C_REGS *i2c;
+    PLX_I2C_Unit_t unit;
+    uint16_t mdr;           // I2CMDR bits common to all transfers
+    uint32_t timeoutTicks;
+    // transactions waiting for the bus, accessed with interrupts disabled
+    PLX_I2C_Transaction_t *queue[PLX_I2C_QUEUE_SIZE];
+    uint16_t head;
+    uint16_t tail;
+    PLX_I2C_Transaction_t *volatile current;
+    PLX_I2C_Status_t error; // first error of the current transaction
+    bool reading;
+    uint32_t timeStamp;     // CPU timer 2 at last bus progress
+    uint32_t nackCount;
+    uint32_t arbitrationLostCount;
+    uint32_t timeoutCount;
+} PLX_I2C_Obj_t;
+
+typedef PLX_I2C_Obj_t *PLX_I2C_Handle_t;
+
+inline void PLX_I2C_sinit(){}
+
+inline bool PLX_I2C_isBusy(PLX_I2C_Handle_t aHandle)
+{
+    PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+    return ((obj->current != NULL) || (obj->head != obj->tail));
+}
+
+inline bool PLX_I2C_isPending(const PLX_I2C_Transaction_t *aTransaction)
+{
+    PLX_I2C_Status_t status = aTransaction->status;
+    return ((status == PLX_I2C_QUEUED) || (status == PLX_I2C_ACTIVE));
+}
+
+inline PLX_I2C_Status_t PLX_I2C_getStatus(const PLX_I2C_Transaction_t *aTransaction)
+{
+    return aTransaction->status;
+}
+
+#endif /* PLX_I2C_IMPL_H_ */
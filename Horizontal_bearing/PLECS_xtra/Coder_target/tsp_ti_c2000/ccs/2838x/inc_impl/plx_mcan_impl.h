@@ -29,6 +29,19 @@ typedef enum PLX_MCAN_UNIT {
     PLX_MCAN_MCAN_0=0,
 } PLX_MCAN_Unit_t;
 
+// storage of received messages
+typedef enum PLX_MCAN_RX_MODE {
+    PLX_MCAN_RX_BUFFERS=0, // dedicated (double) buffer per mailbox
+    PLX_MCAN_RX_FIFO_0,    // shared FIFO, drained by PLX_MCAN_poll()
+    PLX_MCAN_RX_FIFO_1
+} PLX_MCAN_RxMode_t;
+
+// transmission of messages
+typedef enum PLX_MCAN_TX_MODE {
+    PLX_MCAN_TX_BUFFERS=0, // dedicated buffer per mailbox
+    PLX_MCAN_TX_QUEUE      // staged, submitted in ID order by PLX_MCAN_flushTx()
+} PLX_MCAN_TxMode_t;
+
 typedef struct PLX_MCAN_RX_MAILBOX {
     uint32_t mask;
     unsigned char len;
@@ -37,6 +50,7 @@ typedef struct PLX_MCAN_RX_MAILBOX {
 
 typedef struct PLX_MCAN_TX_MAILBOX {
     uint32_t mask;
+    uint32_t dropCount;
     MCAN_TxBufElement buf;
 } PLX_MCAN_TxMailbox_t;
 
@@ -55,9 +69,11 @@ typedef struct PLX_MCAN_PARAMS {
     uint16_t tdcf;
     uint16_t tdco;
 
+    PLX_MCAN_RxMode_t rxMode;
     PLX_MCAN_RxMailbox_t *rxMailboxes;
     uint16_t numRxMailboxes;
 
+    PLX_MCAN_TxMode_t txMode;
     PLX_MCAN_TxMailbox_t *txMailboxes;
     uint16_t numTxMailboxes;
 } PLX_MCAN_Params_t;
@@ -72,6 +88,19 @@ typedef struct PLX_MCAN_OBJ
 
     PLX_MCAN_TxMailbox_t *txMailboxes;
     uint16_t numTxMailboxes;
+
+    // FIFO mode: mailboxes and bus state updated by PLX_MCAN_poll()
+    PLX_MCAN_RxMode_t rxMode;
+    uint32_t rxNewFlags;
+    MCAN_RxBufElement rxFifoElement;
+    bool busOn;
+    bool errorActive;
+
+    // queue mode: mailboxes staged by PLX_MCAN_putMessage(), sorted by ID
+    PLX_MCAN_TxMode_t txMode;
+    uint32_t txStagedFlags;
+    uint16_t txPrio[PLX_MCAN_NUM_CHANNELS];
+    uint16_t numTxPrio;
 } PLX_MCAN_Obj_t;
 
 typedef PLX_MCAN_Obj_t *PLX_MCAN_Handle_t;
@@ -52,6 +52,7 @@ typedef struct PLX_PWR_OBJ
 
     uint16_t numRegisteredPwmChannels;
     PLX_PWM_Handle_t pwmChannels[PLX_PWR_MAX_PWM_CHANNELS];
+    PLX_PWM_Group_t pwmGroup;
 
     uint16_t enableSwitchingReq;
     int16_t pilMode;
@@ -77,12 +78,8 @@ inline void PLX_PWR_syncdSwitchingEnable()
     {
         if(obj->pilMode == false)
         {
-         // enable actuators
-            int i;
-            for(i=0; i< obj->numRegisteredPwmChannels; i++)
-            {
-                PLX_PWM_enableOut(obj->pwmChannels[i]);
-            }
+            // enable actuators
+            PLX_PWM_enableGroupOut(&obj->pwmGroup);
         }
         obj->gatesActive = true;
         obj->enableSwitchingReq = false;
@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef PLX_SDFM_IMPL_H_
+#define PLX_SDFM_IMPL_H_
+
+#include "f2838x_sdfm.h"
+#include "plx_dma.h"
+
+#define PLX_SDFM_NUM_CHANNELS 4
+#define PLX_SDFM_CHANNEL_STEP 16 // words between the register sets of two channels
+
+typedef enum PLX_SDFM_UNIT {
+    PLX_SDFM_SD1 = 0,
+    PLX_SDFM_SD2
+} PLX_SDFM_Unit_t;
+
+// same encoding as SDDFPARMx.SST and SDCPARMx.CS1_CS0
+typedef enum PLX_SDFM_FILTER_TYPE {
+    PLX_SDFM_SINCFAST = 0,
+    PLX_SDFM_SINC1,
+    PLX_SDFM_SINC2,
+    PLX_SDFM_SINC3
+} PLX_SDFM_FilterType_t;
+
+typedef struct PLX_SDFM_CHANNEL_PARAMS {
+    PLX_SDFM_FilterType_t filterType;
+    uint16_t osr;               // data filter oversampling ratio (1..256)
+    float scale;
+    float offset;
+    // comparator, events routed to the ePWM X-BAR (SDxFLTy.COMPH_OR_COMPL)
+    bool compEnable;
+    PLX_SDFM_FilterType_t compFilterType;
+    uint16_t compOsr;           // comparator oversampling ratio (1..32)
+    float compHigh;             // thresholds normalized to full scale (-1..1)
+    float compLow;
+} PLX_SDFM_ChannelParams_t;
+
+typedef struct PLX_SDFM_OBJ {
+    volatile struct SDFM_REGS *sdfm;
+    PLX_SDFM_Unit_t unit;
+    uint16_t channelMask;
+    // filter data registers or DMA copy
+    volatile int16_t *results;
+    uint16_t resultStep;
+    float scale[PLX_SDFM_NUM_CHANNELS];
+    float offset[PLX_SDFM_NUM_CHANNELS];
+    PLX_DMA_Obj_t dmaObj;
+    PLX_DMA_Handle_t dma;
+} PLX_SDFM_Obj_t;
+
+typedef PLX_SDFM_Obj_t *PLX_SDFM_Handle_t;
+
+inline void PLX_SDFM_sinit(){}
+
+inline float PLX_SDFM_getInF(PLX_SDFM_Handle_t aHandle, uint16_t aChannel)
+{
+    PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+
+    PLX_ASSERT(aChannel < PLX_SDFM_NUM_CHANNELS);
+
+    return ((float)obj->results[aChannel*obj->resultStep] * obj->scale[aChannel] + obj->offset[aChannel]);
+}
+
+inline void PLX_SDFM_getFrameF(PLX_SDFM_Handle_t aHandle, float *aOut, uint16_t aMask)
+{
+    PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+    volatile int16_t *results = obj->results;
+    uint16_t step = obj->resultStep;
+    const float *scale = obj->scale;
+    const float *offset = obj->offset;
+
+    // aOut is indexed by channel, channels not in aMask are left untouched
+    uint16_t mask = aMask;
+    uint16_t i = 0;
+    while(mask != 0)
+    {
+        if(mask & 1)
+        {
+            aOut[i] = (float)results[i*step] * scale[i] + offset[i];
+        }
+        mask >>= 1;
+        i++;
+    }
+}
+
+#endif /* PLX_SDFM_IMPL_H_ */
@@ -20,6 +20,9 @@
 #ifndef PLX_SPI_IMPL_H_
 #define PLX_SPI_IMPL_H_
 
+#include "plx_dma.h"
+#include "plx_dio.h"
+
 #define PLX_SPI_FIFO_DEPTH 16
 
 typedef enum PLX_SPI_UNIT {
@@ -42,12 +45,42 @@ typedef struct PLX_SPI_PARAMS {
     bool                MASTERSLAVE; // Slave-0 Master-1
  } PLX_SPI_Params_t;
 
+// one slave access of a transaction sequence
+typedef struct PLX_SPI_TRANSACTION {
+    PLX_DIO_Handle_t cs;  // chip select, active low
+    uint16_t len;         // words, at most PLX_SPI_FIFO_DEPTH
+} PLX_SPI_Transaction_t;
+
 typedef struct PLX_SPI_OBJ {
     PLX_SPI_Unit_t unit;
 	uint32_t portHandle;
 	uint32_t clk;
 	uint16_t txShift;
 	uint16_t rxMask;
+	// DMA frame engine
+	PLX_DMA_Obj_t dmaTxObj;
+	PLX_DMA_Obj_t dmaRxObj;
+	PLX_DMA_Handle_t dmaTx;
+	PLX_DMA_Handle_t dmaRx;
+	uint16_t *dmaTxFrame;
+	uint16_t *dmaRxFrames;
+	uint16_t dmaFrameSize;
+	uint16_t dmaRxBank;
+	// DMA slave frames, bank switching by the RX DMA interrupt
+	PLX_DIO_Obj_t steObj;
+	PLX_DIO_Handle_t ste;
+	volatile uint16_t dmaRxLatest;
+	volatile uint32_t dmaFrameCount;
+	uint32_t dmaFrameCountRead;
+	volatile uint32_t dmaFramingErrorCount;
+	// transaction sequence
+	const PLX_SPI_Transaction_t *trans;
+	uint16_t numTrans;
+	uint16_t *transTxData;
+	uint16_t *transRxData;
+	uint16_t transIndex;
+	uint16_t transOffset;
+	volatile bool transBusy;
 } PLX_SPI_Obj_t;
 
 typedef PLX_SPI_Obj_t *PLX_SPI_Handle_t;
@@ -126,4 +159,54 @@ inline bool PLX_SPI_getWords(PLX_SPI_Handle_t aHandle, uint16_t *aData, uint16_t
     return true;
 }
 
+inline uint16_t *PLX_SPI_getDmaTxFrame(PLX_SPI_Handle_t aHandle)
+{
+    PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+    return obj->dmaTxFrame;
+}
+
+inline bool PLX_SPI_getDmaRxFrame(PLX_SPI_Handle_t aHandle, uint16_t **aFrame)
+{
+    PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+    // the DMA is filling (or about to fill) one bank, the other one holds the
+    // latest complete frame - an offset of two frames means bank 1 just completed
+    uint16_t offset = PLX_DMA_getDstOffset(obj->dmaRx);
+    uint16_t bank = ((offset >= obj->dmaFrameSize) && (offset < 2*obj->dmaFrameSize)) ? 0 : 1;
+
+    *aFrame = &obj->dmaRxFrames[bank*obj->dmaFrameSize];
+    if(bank == obj->dmaRxBank)
+    {
+        return false;
+    }
+    obj->dmaRxBank = bank;
+    return true;
+}
+
+inline bool PLX_SPI_getDmaSlaveRxFrame(PLX_SPI_Handle_t aHandle, uint16_t **aFrame)
+{
+    PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+    uint32_t count = obj->dmaFrameCount;
+    *aFrame = &obj->dmaRxFrames[obj->dmaRxLatest*obj->dmaFrameSize];
+    if(count == obj->dmaFrameCountRead)
+    {
+        return false;
+    }
+    obj->dmaFrameCountRead = count;
+    return true;
+}
+
+inline uint32_t PLX_SPI_getDmaFrameCount(PLX_SPI_Handle_t aHandle)
+{
+    PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+    return obj->dmaFrameCount;
+}
+
+inline uint32_t PLX_SPI_getDmaFramingErrorCount(PLX_SPI_Handle_t aHandle)
+{
+    PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+    return obj->dmaFramingErrorCount;
+}
+
 #endif /* PLX_SPI_IMPL_H_ */
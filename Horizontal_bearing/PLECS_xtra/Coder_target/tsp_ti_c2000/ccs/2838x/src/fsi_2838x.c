@@ -0,0 +1,444 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_fsi.h"
+
+#pragma diag_suppress 112 // PLX_ASSERT(0) in switch statements
+
+#define PLX_FSI_KEY 0xA500 // write key of the master control registers
+#define PLX_FSI_CORE_RST 0x0001
+
+#define PLX_FSI_FRAME_TYPE_NWORD 0x3
+#define PLX_FSI_FRAME_START 0x8000
+
+// TX_EVT_STS/TX_EVT_CLR
+#define PLX_FSI_TX_FRAME_DONE 0x0001
+#define PLX_FSI_TX_BUF_UNDERRUN 0x0002
+#define PLX_FSI_TX_BUF_OVERRUN 0x0004
+#define PLX_FSI_TX_PING_TRIGGERED 0x0008
+
+// RX_EVT_STS/RX_EVT_CLR
+#define PLX_FSI_RX_PING_WD_TO 0x0001
+#define PLX_FSI_RX_CRC_ERR 0x0004
+#define PLX_FSI_RX_TYPE_ERR 0x0008
+#define PLX_FSI_RX_EOF_ERR 0x0010
+#define PLX_FSI_RX_BUF_OVERRUN 0x0020
+#define PLX_FSI_RX_FRAME_DONE 0x0040
+#define PLX_FSI_RX_ERR_FRAME 0x0100
+#define PLX_FSI_RX_PING_FRAME 0x0200
+#define PLX_FSI_RX_FRAME_OVERRUN 0x0400
+#define PLX_FSI_RX_DATA_FRAME 0x0800
+#define PLX_FSI_RX_ALL 0x7FFF
+
+#define PLX_FSI_RX_CORRUPTED (PLX_FSI_RX_CRC_ERR | PLX_FSI_RX_TYPE_ERR | PLX_FSI_RX_EOF_ERR | \
+                              PLX_FSI_RX_BUF_OVERRUN | PLX_FSI_RX_FRAME_OVERRUN)
+
+PLX_FSI_Handle_t PLX_FSI_init(void *aMemory, const size_t aNumBytes)
+{
+	if(aNumBytes < sizeof(PLX_FSI_Obj_t))
+	{
+		return((PLX_FSI_Handle_t)NULL);
+	}
+	PLX_FSI_Handle_t handle = (PLX_FSI_Handle_t)aMemory;
+	return handle;
+}
+
+void PLX_FSI_setDefaultParams(PLX_FSI_Params_t *aParams)
+{
+	aParams->numWords = 1;
+	aParams->numLanes = 1;
+	aParams->prescale = 2;
+	aParams->tag = 0;
+	aParams->pingPeriod = 0;
+	aParams->pingTimeout = 0;
+}
+
+static void PLX_FSI_configureTx(PLX_FSI_Obj_t *obj, const PLX_FSI_Params_t *aParams)
+{
+	volatile struct FSI_TX_REGS *tx = obj->tx;
+
+	tx->TX_MASTER_CTRL.all = PLX_FSI_KEY | PLX_FSI_CORE_RST;
+
+	// FSI clock from SYSCLK
+	tx->TX_CLK_CTRL.bit.CLK_RST = 1;
+	tx->TX_CLK_CTRL.bit.PRESCALE_VAL = aParams->prescale;
+	tx->TX_CLK_CTRL.bit.CLK_RST = 0;
+	tx->TX_CLK_CTRL.bit.CLK_EN = 1;
+
+	tx->TX_OPER_CTRL_LO.bit.SEL_PLLCLK = 0;
+	tx->TX_OPER_CTRL_LO.bit.DATA_WIDTH = (aParams->numLanes == 2) ? 1 : 0;
+	tx->TX_OPER_CTRL_LO.bit.SPI_MODE = 0;
+	tx->TX_OPER_CTRL_LO.bit.START_MODE = 0; // frames started by software
+	tx->TX_OPER_CTRL_LO.bit.SW_CRC = 0;
+	tx->TX_OPER_CTRL_LO.bit.PING_TO_MODE = 1; // ping only if no frame was sent within the period
+
+	tx->TX_BUF_PTR_LOAD.all = 0;
+
+	if(aParams->pingPeriod > 0)
+	{
+		tx->TX_PING_TAG.bit.TAG = aParams->tag;
+		tx->TX_PING_TO_REF = aParams->pingPeriod;
+		tx->TX_PING_CTRL.bit.CNT_RST = 1;
+		tx->TX_PING_CTRL.bit.CNT_RST = 0;
+		tx->TX_PING_CTRL.bit.TIMER_EN = 1;
+	}
+
+	tx->TX_EVT_CLR.all = PLX_FSI_TX_FRAME_DONE | PLX_FSI_TX_BUF_UNDERRUN |
+	                     PLX_FSI_TX_BUF_OVERRUN | PLX_FSI_TX_PING_TRIGGERED;
+	tx->TX_MASTER_CTRL.all = PLX_FSI_KEY;
+
+	// no feedback from the receiver
+	obj->linkUp = true;
+}
+
+static void PLX_FSI_configureRx(PLX_FSI_Obj_t *obj, const PLX_FSI_Params_t *aParams)
+{
+	volatile struct FSI_RX_REGS *rx = obj->rx;
+
+	rx->RX_MASTER_CTRL.all = PLX_FSI_KEY | PLX_FSI_CORE_RST;
+
+	rx->RX_OPER_CTRL.bit.DATA_WIDTH = (aParams->numLanes == 2) ? 1 : 0;
+	rx->RX_OPER_CTRL.bit.SPI_MODE = 0;
+	rx->RX_OPER_CTRL.bit.N_WORDS = aParams->numWords - 1;
+	rx->RX_OPER_CTRL.bit.PING_WD_RST_MODE = 1; // watchdog restarted by any frame
+
+	rx->RX_BUF_PTR_LOAD.all = 0;
+
+	if(aParams->pingTimeout > 0)
+	{
+		rx->RX_PING_WD_REF = aParams->pingTimeout;
+		rx->RX_PING_WD_CTRL.bit.PING_WD_RST = 1;
+		rx->RX_PING_WD_CTRL.bit.PING_WD_RST = 0;
+		rx->RX_PING_WD_CTRL.bit.PING_WD_EN = 1;
+	}
+
+	rx->RX_EVT_CLR.all = PLX_FSI_RX_ALL;
+	rx->RX_MASTER_CTRL.all = PLX_FSI_KEY;
+
+	// up with the first frame
+	obj->linkUp = false;
+}
+
+void PLX_FSI_configure(PLX_FSI_Handle_t aHandle, PLX_FSI_Port_t aPort, const PLX_FSI_Params_t *aParams)
+{
+	PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+
+	PLX_ASSERT((aParams->numWords >= 1) && (aParams->numWords <= PLX_FSI_BUF_SIZE));
+	PLX_ASSERT((aParams->numLanes == 1) || (aParams->numLanes == 2));
+	PLX_ASSERT((aParams->prescale >= 1) && (aParams->prescale <= 0xFF));
+
+	obj->port = aPort;
+	obj->tx = NULL;
+	obj->rx = NULL;
+	obj->numWords = aParams->numWords;
+	obj->tag = aParams->tag & 0x000F;
+	obj->seq = 0;
+	obj->seqValid = false;
+	obj->txPending = false;
+	obj->frameCount = 0;
+	obj->lostFrameCount = 0;
+	obj->pingCount = 0;
+	obj->pingTimeoutCount = 0;
+	obj->crcErrorCount = 0;
+	obj->frameErrorCount = 0;
+	obj->overrunCount = 0;
+	obj->dma = NULL;
+
+	EALLOW;
+	switch(aPort)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case PLX_FSI_TX_A:
+			CpuSysRegs.PCLKCR18.bit.FSITX_A = 1;
+			obj->tx = &FsiTxaRegs;
+			break;
+
+		case PLX_FSI_TX_B:
+			CpuSysRegs.PCLKCR18.bit.FSITX_B = 1;
+			obj->tx = &FsiTxbRegs;
+			break;
+
+		case PLX_FSI_RX_A:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_A = 1;
+			obj->rx = &FsiRxaRegs;
+			break;
+
+		case PLX_FSI_RX_B:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_B = 1;
+			obj->rx = &FsiRxbRegs;
+			break;
+
+		case PLX_FSI_RX_C:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_C = 1;
+			obj->rx = &FsiRxcRegs;
+			break;
+
+		case PLX_FSI_RX_D:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_D = 1;
+			obj->rx = &FsiRxdRegs;
+			break;
+
+		case PLX_FSI_RX_E:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_E = 1;
+			obj->rx = &FsiRxeRegs;
+			break;
+
+		case PLX_FSI_RX_F:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_F = 1;
+			obj->rx = &FsiRxfRegs;
+			break;
+
+		case PLX_FSI_RX_G:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_G = 1;
+			obj->rx = &FsiRxgRegs;
+			break;
+
+		case PLX_FSI_RX_H:
+			CpuSysRegs.PCLKCR18.bit.FSIRX_H = 1;
+			obj->rx = &FsiRxhRegs;
+			break;
+	}
+
+	if(obj->tx != NULL)
+	{
+		PLX_FSI_configureTx(obj, aParams);
+	}
+	else if(obj->rx != NULL)
+	{
+		PLX_FSI_configureRx(obj, aParams);
+	}
+	EDIS;
+}
+
+#pragma CODE_SECTION(PLX_FSI_putFrame, "ramfuncs")
+bool PLX_FSI_putFrame(PLX_FSI_Handle_t aHandle, const uint16_t *aData)
+{
+	PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+	volatile struct FSI_TX_REGS *tx = obj->tx;
+
+	PLX_ASSERT(tx != NULL);
+
+	if(obj->txPending && ((tx->TX_EVT_STS.all & PLX_FSI_TX_FRAME_DONE) == 0))
+	{
+		return false;
+	}
+	tx->TX_EVT_CLR.all = PLX_FSI_TX_FRAME_DONE;
+
+	tx->TX_BUF_PTR_LOAD.all = 0;
+	uint16_t i;
+	for(i=0; i<obj->numWords; i++)
+	{
+		tx->TX_BUF_BASE[i] = aData[i];
+	}
+
+	// rolling sequence number in the user data, for lost frame detection
+	obj->seq = (obj->seq + 1) & 0x00FF;
+	tx->TX_FRAME_TAG_UDATA.all = (obj->seq << 8) | obj->tag;
+	tx->TX_FRAME_CTRL.all = PLX_FSI_FRAME_START | ((obj->numWords - 1) << 4) | PLX_FSI_FRAME_TYPE_NWORD;
+
+	obj->txPending = true;
+	obj->frameCount++;
+	return true;
+}
+
+#pragma CODE_SECTION(PLX_FSI_getFrame, "ramfuncs")
+bool PLX_FSI_getFrame(PLX_FSI_Handle_t aHandle, uint16_t *aData)
+{
+	PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+	volatile struct FSI_RX_REGS *rx = obj->rx;
+
+	PLX_ASSERT(rx != NULL);
+
+	if((rx->RX_EVT_STS.all & PLX_FSI_RX_DATA_FRAME) == 0)
+	{
+		return false;
+	}
+	// cleared first, so that a frame arriving while reading is detected
+	rx->RX_EVT_CLR.all = PLX_FSI_RX_DATA_FRAME | PLX_FSI_RX_FRAME_DONE;
+
+	uint16_t seq = rx->RX_FRAME_TAG_UDATA.bit.USER_DATA;
+
+	// the buffer pointer points behind the last received word
+	uint16_t ptr = (rx->RX_BUF_PTR_STS.bit.CURR_BUF_PTR - obj->numWords) & (PLX_FSI_BUF_SIZE - 1);
+	uint16_t i;
+	for(i=0; i<obj->numWords; i++)
+	{
+		aData[i] = rx->RX_BUF_BASE[(ptr + i) & (PLX_FSI_BUF_SIZE - 1)];
+	}
+
+	if((rx->RX_EVT_STS.all & PLX_FSI_RX_DATA_FRAME) != 0)
+	{
+		// overwritten while reading, the next call returns the new frame
+		obj->overrunCount++;
+		return false;
+	}
+
+	if(obj->seqValid)
+	{
+		obj->lostFrameCount += (seq - obj->seq - 1) & 0x00FF;
+	}
+	obj->seq = seq;
+	obj->seqValid = true;
+	obj->frameCount++;
+	obj->linkUp = true;
+	return true;
+}
+
+static void PLX_FSI_startDmaRx(PLX_FSI_Obj_t *obj)
+{
+	uint16_t framesPerBuffer = PLX_FSI_BUF_SIZE / obj->numWords;
+
+	PLX_DMA_Params_t params;
+	PLX_DMA_setDefaultParams(&params);
+	switch(obj->port)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case PLX_FSI_RX_A:
+			params.trigger = PLX_DMA_TRIGGER_FSIRXA;
+			break;
+
+		case PLX_FSI_RX_B:
+			params.trigger = PLX_DMA_TRIGGER_FSIRXB;
+			break;
+
+		case PLX_FSI_RX_C:
+		case PLX_FSI_RX_D:
+		case PLX_FSI_RX_E:
+		case PLX_FSI_RX_F:
+		case PLX_FSI_RX_G:
+		case PLX_FSI_RX_H:
+			params.trigger = PLX_DMA_TRIGGER_FSIRXC + (uint16_t)(obj->port - PLX_FSI_RX_C);
+			break;
+	}
+
+	// source follows the circular receive buffer, one frame per burst
+	params.srcAddr = &obj->rx->RX_BUF_BASE[0];
+	params.burstSize = obj->numWords;
+	params.srcWrapSize = framesPerBuffer;
+	params.srcWrapStep = 0;
+
+	// destination alternates between the two banks (ping-pong)
+	params.dstAddr = obj->dmaRxFrames;
+	params.dstWrapSize = 2;
+	params.dstWrapStep = 0;
+
+	params.transferSize = (framesPerBuffer > 2) ? framesPerBuffer : 2;
+	params.continuous = true;
+
+	PLX_DMA_configure(obj->dma, obj->dmaChannel, &params);
+
+	EALLOW;
+	obj->rx->RX_BUF_PTR_LOAD.all = 0;
+	obj->rx->RX_DMA_CTRL.bit.DMA_EVT_EN = 1;
+	EDIS;
+
+	obj->dmaRxBank = 1;
+	PLX_DMA_start(obj->dma);
+}
+
+void PLX_FSI_setupDmaRxFrames(PLX_FSI_Handle_t aHandle, uint16_t aDmaChannel, uint16_t *aRxFrames)
+{
+	PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+
+	PLX_ASSERT(obj->rx != NULL);
+	// frames must not straddle the end of the circular buffer
+	PLX_ASSERT((obj->numWords & (obj->numWords - 1)) == 0);
+
+	obj->dmaRxFrames = aRxFrames;
+	obj->dmaChannel = aDmaChannel;
+
+	// the DMA buffers are not initialized at startup
+	uint16_t i;
+	for(i=0; i<2*obj->numWords; i++)
+	{
+		aRxFrames[i] = 0;
+	}
+
+	obj->dma = PLX_DMA_init(&obj->dmaObj, sizeof(obj->dmaObj));
+	PLX_FSI_startDmaRx(obj);
+}
+
+void PLX_FSI_updateStatus(PLX_FSI_Handle_t aHandle)
+{
+	PLX_FSI_Obj_t *obj = (PLX_FSI_Obj_t *)aHandle;
+
+	if(obj->tx != NULL)
+	{
+		uint16_t sts = obj->tx->TX_EVT_STS.all &
+		        (PLX_FSI_TX_BUF_UNDERRUN | PLX_FSI_TX_BUF_OVERRUN | PLX_FSI_TX_PING_TRIGGERED);
+		obj->tx->TX_EVT_CLR.all = sts;
+
+		if(sts & PLX_FSI_TX_PING_TRIGGERED)
+		{
+			obj->pingCount++;
+		}
+		if(sts & (PLX_FSI_TX_BUF_UNDERRUN | PLX_FSI_TX_BUF_OVERRUN))
+		{
+			obj->overrunCount++;
+		}
+		return;
+	}
+
+	uint16_t mask = PLX_FSI_RX_PING_WD_TO | PLX_FSI_RX_CORRUPTED | PLX_FSI_RX_ERR_FRAME | PLX_FSI_RX_PING_FRAME;
+	if(obj->dma != NULL)
+	{
+		// with CPU reception, data frames are acknowledged by PLX_FSI_getFrame()
+		mask |= PLX_FSI_RX_DATA_FRAME | PLX_FSI_RX_FRAME_DONE;
+	}
+	uint16_t sts = obj->rx->RX_EVT_STS.all & mask;
+	obj->rx->RX_EVT_CLR.all = sts;
+
+	if(sts & PLX_FSI_RX_PING_WD_TO)
+	{
+		obj->pingTimeoutCount++;
+		obj->linkUp = false;
+	}
+	if(sts & (PLX_FSI_RX_PING_FRAME | PLX_FSI_RX_DATA_FRAME))
+	{
+		obj->linkUp = true;
+	}
+	if(sts & PLX_FSI_RX_PING_FRAME)
+	{
+		obj->pingCount++;
+	}
+	if(sts & PLX_FSI_RX_CRC_ERR)
+	{
+		obj->crcErrorCount++;
+	}
+	if(sts & (PLX_FSI_RX_TYPE_ERR | PLX_FSI_RX_EOF_ERR | PLX_FSI_RX_ERR_FRAME))
+	{
+		obj->frameErrorCount++;
+	}
+	if(sts & (PLX_FSI_RX_BUF_OVERRUN | PLX_FSI_RX_FRAME_OVERRUN))
+	{
+		obj->overrunCount++;
+	}
+
+	if((obj->dma != NULL) && (sts & PLX_FSI_RX_CORRUPTED))
+	{
+		// a corrupted frame may have advanced the buffer pointer without DMA event
+		PLX_FSI_startDmaRx(obj);
+	}
+}
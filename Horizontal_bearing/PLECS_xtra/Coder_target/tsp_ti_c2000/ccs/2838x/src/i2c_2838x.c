@@ -0,0 +1,426 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_i2c.h"
+
+#pragma diag_suppress 112 // PLX_ASSERT(0) in switch statements
+
+// I2CISRC.INTCODE
+#define PLX_I2C_INT_ARBL 1
+#define PLX_I2C_INT_NACK 2
+#define PLX_I2C_INT_ARDY 3
+#define PLX_I2C_INT_SCD 6
+
+#define PLX_I2C_MAX_MODULE_CLK_HZ 12000000L
+
+// CPU timer 2 is not used otherwise and free-running since reset
+static uint32_t PLX_I2C_getTimeStamp()
+{
+	return CpuTimer2Regs.TIM.all;
+}
+
+static void PLX_I2C_clearStatus(PLX_I2C_Obj_t *obj, uint16_t aMask)
+{
+	obj->i2c->I2CSTR.all = aMask; // write 1 to clear
+}
+
+static void PLX_I2C_resetFifos(PLX_I2C_Obj_t *obj)
+{
+	obj->i2c->I2CFFTX.bit.TXFFRST = 0;
+	obj->i2c->I2CFFRX.bit.RXFFRST = 0;
+	obj->i2c->I2CFFTX.bit.TXFFRST = 1;
+	obj->i2c->I2CFFRX.bit.RXFFRST = 1;
+}
+
+static void PLX_I2C_startRead(PLX_I2C_Obj_t *obj)
+{
+	union I2CMDR_REG mdr;
+
+	obj->reading = true;
+	obj->i2c->I2CCNT = obj->current->rxLen;
+
+	// (repeated) start in receive mode, stop after the last byte
+	mdr.all = obj->mdr;
+	mdr.bit.MST = 1;
+	mdr.bit.STT = 1;
+	mdr.bit.STP = 1;
+	obj->i2c->I2CMDR.all = mdr.all;
+}
+
+static void PLX_I2C_startWrite(PLX_I2C_Obj_t *obj)
+{
+	PLX_I2C_Transaction_t *t = obj->current;
+	union I2CMDR_REG mdr;
+
+	obj->reading = false;
+	obj->i2c->I2CCNT = t->txLen;
+
+	// the entire write phase fits into the FIFO
+	uint16_t i;
+	for(i=0; i<t->txLen; i++)
+	{
+		obj->i2c->I2CDXR.all = t->txData[i] & 0xFF;
+	}
+
+	// without a read phase, stop after the last byte, otherwise wait for ARDY
+	mdr.all = obj->mdr;
+	mdr.bit.MST = 1;
+	mdr.bit.TRX = 1;
+	mdr.bit.STT = 1;
+	mdr.bit.STP = (t->rxLen == 0);
+	obj->i2c->I2CMDR.all = mdr.all;
+}
+
+// must be called with interrupts disabled
+static void PLX_I2C_startNext(PLX_I2C_Obj_t *obj)
+{
+	if((obj->current != NULL) || (obj->head == obj->tail))
+	{
+		return;
+	}
+	if(obj->i2c->I2CSTR.bit.BB)
+	{
+		// retried by PLX_I2C_poll()
+		return;
+	}
+
+	PLX_I2C_Transaction_t *t = obj->queue[obj->tail];
+	obj->tail = (obj->tail + 1) & (PLX_I2C_QUEUE_SIZE - 1);
+
+	obj->current = t;
+	obj->error = PLX_I2C_DONE;
+	obj->timeStamp = PLX_I2C_getTimeStamp();
+	t->status = PLX_I2C_ACTIVE;
+
+	PLX_I2C_resetFifos(obj);
+	obj->i2c->I2CSAR.bit.SAR = t->address;
+	if(t->txLen > 0)
+	{
+		PLX_I2C_startWrite(obj);
+	}
+	else
+	{
+		PLX_I2C_startRead(obj);
+	}
+}
+
+static void PLX_I2C_complete(PLX_I2C_Obj_t *obj)
+{
+	PLX_I2C_Transaction_t *t = obj->current;
+
+	if((obj->error == PLX_I2C_DONE) && obj->reading)
+	{
+		uint16_t i;
+		for(i=0; i<t->rxLen; i++)
+		{
+			t->rxData[i] = obj->i2c->I2CDRR.all & 0xFF;
+		}
+	}
+	t->status = obj->error;
+
+	obj->current = NULL;
+	obj->timeStamp = PLX_I2C_getTimeStamp();
+	PLX_I2C_startNext(obj);
+}
+
+// puts the module through a reset, e.g. after a timeout
+static void PLX_I2C_reset(PLX_I2C_Obj_t *obj)
+{
+	obj->i2c->I2CMDR.bit.IRS = 0;
+	PLX_I2C_resetFifos(obj);
+	obj->i2c->I2CMDR.all = obj->mdr;
+}
+
+PLX_I2C_Handle_t PLX_I2C_init(void *aMemory, const size_t aNumBytes)
+{
+	if(aNumBytes < sizeof(PLX_I2C_Obj_t))
+	{
+		return((PLX_I2C_Handle_t)NULL);
+	}
+	PLX_I2C_Handle_t handle = (PLX_I2C_Handle_t)aMemory;
+	return handle;
+}
+
+void PLX_I2C_setDefaultParams(PLX_I2C_Params_t *aParams)
+{
+	aParams->bitRate = 100000L;
+	aParams->timeoutTicks = 0;
+}
+
+void PLX_I2C_configure(PLX_I2C_Handle_t aHandle, PLX_I2C_Unit_t aUnit, uint32_t aSysClkHz, const PLX_I2C_Params_t *aParams)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+
+	EALLOW;
+	switch(aUnit)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case PLX_I2C_I2C_A:
+			CpuSysRegs.PCLKCR9.bit.I2C_A = 1;
+			obj->i2c = &I2caRegs;
+			break;
+
+		case PLX_I2C_I2C_B:
+			CpuSysRegs.PCLKCR9.bit.I2C_B = 1;
+			obj->i2c = &I2cbRegs;
+			break;
+	}
+	EDIS;
+
+	obj->unit = aUnit;
+	obj->timeoutTicks = aParams->timeoutTicks;
+	obj->head = 0;
+	obj->tail = 0;
+	obj->current = NULL;
+	obj->error = PLX_I2C_DONE;
+	obj->reading = false;
+	obj->timeStamp = PLX_I2C_getTimeStamp();
+	obj->nackCount = 0;
+	obj->arbitrationLostCount = 0;
+	obj->timeoutCount = 0;
+
+	// module clock must be within 7..12 MHz
+	uint32_t psc = (aSysClkHz + PLX_I2C_MAX_MODULE_CLK_HZ - 1) / PLX_I2C_MAX_MODULE_CLK_HZ;
+	PLX_ASSERT((psc >= 1) && (psc <= 256));
+	uint32_t moduleClk = aSysClkHz / psc;
+
+	// clock divider adds d module clocks to each of the low and high times
+	uint16_t d = 5;
+	if(psc == 1)
+	{
+		d = 7;
+	}
+	else if(psc == 2)
+	{
+		d = 6;
+	}
+
+	// 50% duty in standard mode, low time of 2/3 period in fast mode
+	uint32_t divider = moduleClk / aParams->bitRate;
+	uint32_t high = divider / 2;
+	if(aParams->bitRate > 100000L)
+	{
+		high = divider / 3;
+	}
+	PLX_ASSERT(high > d);
+	PLX_ASSERT((divider - high) > d);
+	PLX_ASSERT((divider - high - d) <= 0xFFFF);
+
+	union I2CMDR_REG mdr;
+	mdr.all = 0;
+	mdr.bit.BC = 0;   // 8 bits per byte
+	mdr.bit.FREE = 1; // keep running when halted by the debugger
+	obj->i2c->I2CMDR.all = mdr.all; // hold in reset
+
+	obj->i2c->I2CPSC.bit.IPSC = psc - 1;
+	obj->i2c->I2CCLKL = divider - high - d;
+	obj->i2c->I2CCLKH = high - d;
+
+	obj->i2c->I2CFFTX.all = 0;
+	obj->i2c->I2CFFRX.all = 0;
+	obj->i2c->I2CFFTX.bit.I2CFFEN = 1;
+	PLX_I2C_resetFifos(obj);
+
+	// completion is signaled by ARDY (write phase before repeated start) and SCD
+	obj->i2c->I2CIER.all = 0;
+	obj->i2c->I2CIER.bit.ARBL = 1;
+	obj->i2c->I2CIER.bit.NACK = 1;
+	obj->i2c->I2CIER.bit.ARDY = 1;
+	obj->i2c->I2CIER.bit.SCD = 1;
+
+	mdr.bit.IRS = 1;
+	obj->mdr = mdr.all;
+	obj->i2c->I2CMDR.all = obj->mdr;
+}
+
+void PLX_I2C_setupTransaction(PLX_I2C_Transaction_t *aTransaction, uint16_t aAddress, const uint16_t *aTxData, uint16_t aTxLen, uint16_t *aRxData, uint16_t aRxLen)
+{
+	PLX_ASSERT(aAddress <= 0x7F);
+	PLX_ASSERT(aTxLen <= PLX_I2C_FIFO_DEPTH);
+	PLX_ASSERT(aRxLen <= PLX_I2C_FIFO_DEPTH);
+	PLX_ASSERT((aTxLen > 0) || (aRxLen > 0));
+
+	aTransaction->address = aAddress;
+	aTransaction->txData = aTxData;
+	aTransaction->txLen = aTxLen;
+	aTransaction->rxData = aRxData;
+	aTransaction->rxLen = aRxLen;
+	aTransaction->status = PLX_I2C_IDLE;
+}
+
+bool PLX_I2C_queueTransaction(PLX_I2C_Handle_t aHandle, PLX_I2C_Transaction_t *aTransaction)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+
+	if(PLX_I2C_isPending(aTransaction))
+	{
+		return false;
+	}
+
+	bool queued = false;
+	DINT; // queue may be accessed from several tasks and PLX_I2C_isr()
+	uint16_t next = (obj->head + 1) & (PLX_I2C_QUEUE_SIZE - 1);
+	if(next != obj->tail)
+	{
+		if(!PLX_I2C_isBusy(obj))
+		{
+			// timeout starts with the first pending transaction
+			obj->timeStamp = PLX_I2C_getTimeStamp();
+		}
+		aTransaction->status = PLX_I2C_QUEUED;
+		obj->queue[obj->head] = aTransaction;
+		obj->head = next;
+		PLX_I2C_startNext(obj);
+		queued = true;
+	}
+	EINT;
+	return queued;
+}
+
+bool PLX_I2C_getRxData(PLX_I2C_Transaction_t *aTransaction, uint16_t *aData)
+{
+	if(aTransaction->status != PLX_I2C_DONE)
+	{
+		return false;
+	}
+	uint16_t i;
+	for(i=0; i<aTransaction->rxLen; i++)
+	{
+		aData[i] = aTransaction->rxData[i];
+	}
+	aTransaction->status = PLX_I2C_IDLE;
+	return true;
+}
+
+#pragma CODE_SECTION(PLX_I2C_isr, "ramfuncs")
+void PLX_I2C_isr(PLX_I2C_Handle_t aHandle)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+	union I2CSTR_REG clr;
+	uint16_t code;
+
+	// reading I2CISRC clears the flag of the reported event
+	while((code = obj->i2c->I2CISRC.bit.INTCODE) != 0)
+	{
+		clr.all = 0;
+		switch(code)
+		{
+			default:
+				break;
+
+			case PLX_I2C_INT_NACK:
+				// release the bus, completed by the stop condition
+				obj->i2c->I2CMDR.bit.STP = 1;
+				clr.bit.NACK = 1;
+				PLX_I2C_clearStatus(obj, clr.all);
+				if((obj->current != NULL) && (obj->error == PLX_I2C_DONE))
+				{
+					obj->error = PLX_I2C_NACK;
+					obj->nackCount++;
+				}
+				break;
+
+			case PLX_I2C_INT_ARBL:
+				// module has dropped to slave mode, no stop condition follows
+				clr.bit.ARBL = 1;
+				PLX_I2C_clearStatus(obj, clr.all);
+				obj->arbitrationLostCount++;
+				if(obj->current != NULL)
+				{
+					obj->error = PLX_I2C_ARBITRATION_LOST;
+					PLX_I2C_complete(obj);
+				}
+				break;
+
+			case PLX_I2C_INT_ARDY:
+				clr.bit.ARDY = 1;
+				PLX_I2C_clearStatus(obj, clr.all);
+				if((obj->current != NULL) && !obj->reading && (obj->error == PLX_I2C_DONE)
+						&& (obj->current->rxLen > 0))
+				{
+					obj->timeStamp = PLX_I2C_getTimeStamp();
+					PLX_I2C_startRead(obj);
+				}
+				break;
+
+			case PLX_I2C_INT_SCD:
+				clr.bit.SCD = 1;
+				PLX_I2C_clearStatus(obj, clr.all);
+				if(obj->current != NULL)
+				{
+					PLX_I2C_complete(obj);
+				}
+				break;
+		}
+	}
+}
+
+void PLX_I2C_poll(PLX_I2C_Handle_t aHandle)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+
+	DINT; // PLX_I2C_isr() is the regular consumer
+	PLX_I2C_startNext(obj);
+
+	if((obj->timeoutTicks != 0) && PLX_I2C_isBusy(obj))
+	{
+		// CPU timer counts down
+		uint32_t elapsed = obj->timeStamp - PLX_I2C_getTimeStamp();
+		if(elapsed > obj->timeoutTicks)
+		{
+			obj->timeoutCount++;
+			PLX_I2C_reset(obj);
+			if(obj->current != NULL)
+			{
+				obj->current->status = PLX_I2C_TIMEOUT;
+				obj->current = NULL;
+			}
+			else
+			{
+				// bus has been busy since the transaction was queued
+				obj->queue[obj->tail]->status = PLX_I2C_TIMEOUT;
+				obj->tail = (obj->tail + 1) & (PLX_I2C_QUEUE_SIZE - 1);
+			}
+			obj->timeStamp = PLX_I2C_getTimeStamp();
+			PLX_I2C_startNext(obj);
+		}
+	}
+	EINT;
+}
+
+uint32_t PLX_I2C_getNackCount(PLX_I2C_Handle_t aHandle)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+	return obj->nackCount;
+}
+
+uint32_t PLX_I2C_getArbitrationLostCount(PLX_I2C_Handle_t aHandle)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+	return obj->arbitrationLostCount;
+}
+
+uint32_t PLX_I2C_getTimeoutCount(PLX_I2C_Handle_t aHandle)
+{
+	PLX_I2C_Obj_t *obj = (PLX_I2C_Obj_t *)aHandle;
+	return obj->timeoutCount;
+}
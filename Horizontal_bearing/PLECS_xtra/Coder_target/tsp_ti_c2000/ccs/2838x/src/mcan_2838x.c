@@ -21,6 +21,7 @@
 
 #include "mcan.h"
 #include "inc/stw_types.h"
+#include "inc/hw_types_mcan.h"
 
 #define MCAN_NUM_RX_MAILBOXES 64
 #define MCAN_NUM_TX_MAILBOXES 32
@@ -43,13 +44,18 @@
 
 #define MCAN_TX_BUFF_START_ADDR (MCAN_EXT_ID_FILT_END_ADDR)
 #define MCAN_TX_BUFF_SIZE (MCAN_NUM_TX_MAILBOXES)
+#define MCAN_TX_BUFF_MASK (0xFFFFFFFFUL >> (32 - MCAN_TX_BUFF_SIZE)) // one bit per buffer, valid up to 32
 #define MCAN_TX_BUFF_END_ADDR (MCAN_TX_BUFF_START_ADDR + MCAN_TX_BUFF_SIZE * MCAN_MEM_TX_MSG_SIZE_WORDS_32)
 
 #define MCAN_RX_BUFF_START_ADDR (MCAN_TX_BUFF_END_ADDR)
 #define MCAN_RX_BUFF_SIZE (MCAN_NUM_RX_MAILBOXES)
 #define MCAN_RX_BUFF_END_ADDR (MCAN_RX_BUFF_START_ADDR + MCAN_RX_BUFF_SIZE * MCAN_MEM_RX_MSG_SIZE_WORDS_32)
 
-#if MCAN_RX_BUFF_END_ADDR > MCAN_MEM_SIZE_WORDS_32
+#define MCAN_RX_FIFO_START_ADDR (MCAN_RX_BUFF_END_ADDR)
+#define MCAN_RX_FIFO_SIZE (64)
+#define MCAN_RX_FIFO_END_ADDR (MCAN_RX_FIFO_START_ADDR + MCAN_RX_FIFO_SIZE * MCAN_MEM_RX_MSG_SIZE_WORDS_32)
+
+#if MCAN_RX_FIFO_END_ADDR > MCAN_MEM_SIZE_WORDS_32
 #error MCAN memory map overflow
 #endif
 
@@ -69,6 +75,30 @@ static uint32_t PLX_MCAN_getDataSize(uint32_t dlc)
     return(dataSize[dlc]);
 }
 
+static void PLX_MCAN_copyRxMessage(const MCAN_RxBufElement *rxMsg, unsigned char data[], unsigned char lenMax, uint16_t *aFlags)
+{
+    int dataLen = PLX_MCAN_getDataSize(rxMsg->dlc);
+    // we could be strict and check against obj->rxMailboxes[aMailBox].len
+    int i;
+    for(i=0; i<lenMax; i++){
+        if(i<dataLen){
+            data[i] = rxMsg->data[i];
+        } else {
+            data[i] = PLX_MCAN_PADDING_VALUE;
+        }
+    }
+    *aFlags = 0;
+    if(rxMsg->esi){
+        *aFlags |= PLX_MCAN_ESI_FLAG;
+    }
+    if(rxMsg->fdf){
+        *aFlags |= PLX_MCAN_FD_FLAG;
+    }
+    if(rxMsg->brs){
+        *aFlags |= PLX_MCAN_BRS_FLAG;
+    }
+}
+
 void PLX_MCAN_sinit()
 {
     ;
@@ -102,8 +132,17 @@ void PLX_MCAN_configure(PLX_MCAN_Handle_t aHandle, PLX_MCAN_Unit_t aUnit, const
         int i;
         for(i=0; i<obj->numTxMailboxes; i++){
             obj->txMailboxes[i].mask = 0;
+            obj->txMailboxes[i].dropCount = 0;
         }
     }
+    obj->txMode = aParams->txMode;
+    obj->txStagedFlags = 0;
+    obj->numTxPrio = 0;
+    obj->rxMode = aParams->rxMode;
+    obj->rxNewFlags = 0;
+    obj->busOn = false;
+    obj->errorActive = false;
+
     switch(aUnit)
     {
         case PLX_MCAN_MCAN_0:
@@ -154,8 +193,15 @@ void PLX_MCAN_configure(PLX_MCAN_Handle_t aHandle, PLX_MCAN_Unit_t aUnit, const
 
     // configure memory map for tx buffers
     msgRAMConfigParams.txStartAddr          = MCAN_TX_BUFF_START_ADDR*4;
-    msgRAMConfigParams.txBufNum             = MCAN_TX_BUFF_SIZE;
-    msgRAMConfigParams.txBufMode            = 0U;
+    if(obj->txMode == PLX_MCAN_TX_QUEUE){
+        // same memory used as tx queue, arbitration by message ID
+        msgRAMConfigParams.txBufNum         = 0U;
+        msgRAMConfigParams.txFIFOSize       = MCAN_TX_BUFF_SIZE;
+        msgRAMConfigParams.txBufMode        = 1U;
+    } else {
+        msgRAMConfigParams.txBufNum         = MCAN_TX_BUFF_SIZE;
+        msgRAMConfigParams.txBufMode        = 0U;
+    }
     msgRAMConfigParams.txBufElemSize        = MCAN_ELEM_SIZE_64BYTES;
 
     // configure memory map for rx buffers
@@ -170,6 +216,19 @@ void PLX_MCAN_configure(PLX_MCAN_Handle_t aHandle, PLX_MCAN_Unit_t aUnit, const
     msgRAMConfigParams.flesa                = MCAN_EXT_ID_FILT_START_ADDR*4;
     msgRAMConfigParams.lse                  = MCAN_EXT_ID_FILTER_NUM;
 
+    // configure memory map for rx FIFO, overwrite mode keeps the latest messages
+    if(obj->rxMode == PLX_MCAN_RX_FIFO_0){
+        msgRAMConfigParams.rxFIFO0startAddr = MCAN_RX_FIFO_START_ADDR*4;
+        msgRAMConfigParams.rxFIFO0size      = MCAN_RX_FIFO_SIZE;
+        msgRAMConfigParams.rxFIFO0OpMode    = 1U;
+        msgRAMConfigParams.rxFIFO0ElemSize  = MCAN_ELEM_SIZE_64BYTES;
+    } else if(obj->rxMode == PLX_MCAN_RX_FIFO_1){
+        msgRAMConfigParams.rxFIFO1startAddr = MCAN_RX_FIFO_START_ADDR*4;
+        msgRAMConfigParams.rxFIFO1size      = MCAN_RX_FIFO_SIZE;
+        msgRAMConfigParams.rxFIFO1OpMode    = 1U;
+        msgRAMConfigParams.rxFIFO1ElemSize  = MCAN_ELEM_SIZE_64BYTES;
+    }
+
     // Note: FIFOs are disabled if rxFIFOXsize, txFIFOSize, txEventFIFOSize = 0
 
     while(!MCAN_isMemInitDone(obj->portHandle)){
@@ -214,6 +273,26 @@ void PLX_MCAN_setupRxMailbox(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox,
 
     obj->rxMailboxes[aMailBox].mask = ((uint32_t)1U << aMailBox);
     obj->rxMailboxes[aMailBox].len = PLX_MCAN_getDataSize(aDlc);
+    if(obj->rxMode != PLX_MCAN_RX_BUFFERS){
+        // classic filter (ID and mask) into the FIFO, the filter index tells the mailbox
+        uint32_t fec = (obj->rxMode == PLX_MCAN_RX_FIFO_0) ? 0x1 : 0x2;
+        if(isExtended){
+            MCAN_ExtMsgIDFilterElement filterElement = {0};
+            filterElement.efec               = fec;
+            filterElement.eft                = 0x2;
+            filterElement.efid1              = aId;
+            filterElement.efid2              = 0x1FFFFFFF;
+            MCAN_addExtMsgIDFilter(obj->portHandle, aMailBox, &filterElement);
+        } else {
+            MCAN_StdMsgIDFilterElement filterElement = {0};
+            filterElement.sfec               = fec;
+            filterElement.sft                = 0x2;
+            filterElement.sfid1              = aId;
+            filterElement.sfid2              = 0x7FF;
+            MCAN_addStdMsgIDFilter(obj->portHandle, aMailBox, &filterElement);
+        }
+        return;
+    }
     if(isExtended){
         MCAN_ExtMsgIDFilterElement filterElement = {0};
         filterElement.efec               = 0x7; // destination is Rx Buffer
@@ -272,11 +351,24 @@ void PLX_MCAN_setupTxMailbox(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox,
     for(i = 0; i < MCAN_MAX_PAYLOAD_BYTES; i++){
         txMsg->data[i]  = PLX_MCAN_PADDING_VALUE;
     }
+
+    // keep mailboxes sorted by ID (lowest first), standard IDs are left aligned
+    PLX_ASSERT(obj->numTxPrio < PLX_MCAN_NUM_CHANNELS);
+    i = obj->numTxPrio++;
+    while((i > 0) && (obj->txMailboxes[obj->txPrio[i-1]].buf.id > txMsg->id)){
+        obj->txPrio[i] = obj->txPrio[i-1];
+        i--;
+    }
+    obj->txPrio[i] = aMailBox;
 }
 
 bool PLX_MCAN_isBusOn(PLX_MCAN_Handle_t aHandle){
     PLX_MCAN_Obj_t *obj = (PLX_MCAN_Obj_t *)aHandle;
 
+    if(obj->rxMode != PLX_MCAN_RX_BUFFERS){
+        return obj->busOn; // sampled by PLX_MCAN_poll()
+    }
+
     if(MCAN_OPERATION_MODE_NORMAL != MCAN_getOpMode(obj->portHandle)){
         return false;
     }
@@ -290,6 +382,10 @@ bool PLX_MCAN_isBusOn(PLX_MCAN_Handle_t aHandle){
 bool PLX_MCAN_isErrorActive(PLX_MCAN_Handle_t aHandle){
     PLX_MCAN_Obj_t *obj = (PLX_MCAN_Obj_t *)aHandle;
 
+    if(obj->rxMode != PLX_MCAN_RX_BUFFERS){
+        return obj->errorActive; // sampled by PLX_MCAN_poll()
+    }
+
     MCAN_ProtocolStatus protStatus;
     MCAN_getProtocolStatus(obj->portHandle, &protStatus);
 
@@ -326,6 +422,19 @@ bool PLX_MCAN_getMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, unsigned
         return false;
     }
 
+    if(obj->rxMode != PLX_MCAN_RX_BUFFERS){
+        // no register access, the mailbox was filled by PLX_MCAN_poll()
+        uint32_t mask = obj->rxMailboxes[aMailBox].mask;
+        if((obj->rxNewFlags & mask) == 0){
+            return false;
+        }
+        DINT; // PLX_MCAN_poll() may be called from a different task
+        PLX_MCAN_copyRxMessage(&obj->rxMailboxes[aMailBox].buf, data, lenMax, aFlags);
+        obj->rxNewFlags &= ~mask;
+        EINT;
+        return true;
+    }
+
     MCAN_RxNewDataStatus newData = {0};
     MCAN_getNewDataStatus(obj->portHandle, &newData);
     newData.statusLow &= obj->rxMailboxes[aMailBox].mask; // flags for Rx buffer no. 0 to 31
@@ -338,26 +447,7 @@ bool PLX_MCAN_getMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, unsigned
         } else {
             MCAN_readMsgRam(obj->portHandle, MCAN_MEM_TYPE_BUF, aMailBox+32, 0, rxMsg);
         }
-        int dataLen = PLX_MCAN_getDataSize(rxMsg->dlc);
-        // we could be strict and check against obj->rxMailboxes[aMailBox].len
-        int i;
-        for(i=0; i<lenMax; i++){
-            if(i<dataLen){
-                data[i] = rxMsg->data[i];
-            } else {
-                data[i] = PLX_MCAN_PADDING_VALUE;
-            }
-        }
-        *aFlags = 0;
-        if(rxMsg->esi){
-            *aFlags |= PLX_MCAN_ESI_FLAG;
-        }
-        if(rxMsg->fdf){
-            *aFlags |= PLX_MCAN_FD_FLAG;
-        }
-        if(rxMsg->brs){
-            *aFlags |= PLX_MCAN_BRS_FLAG;
-        }
+        PLX_MCAN_copyRxMessage(rxMsg, data, lenMax, aFlags);
         MCAN_clearNewDataStatus(obj->portHandle, &newData);
         return true;
     } else {
@@ -371,15 +461,32 @@ bool PLX_MCAN_putMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, const uns
     PLX_ASSERT(obj->txMailboxes[aMailBox].mask);
 
     if(!PLX_MCAN_isBusOn(aHandle)){
+        obj->txMailboxes[aMailBox].dropCount++;
         return false;
     }
 
+    MCAN_TxBufElement *txMsg = &obj->txMailboxes[aMailBox].buf;
+    int i;
+
+    if(obj->txMode == PLX_MCAN_TX_QUEUE){
+        uint32_t mask = obj->txMailboxes[aMailBox].mask;
+        DINT; // PLX_MCAN_flushTx() may be called from a different task
+        if((obj->txStagedFlags & mask) != 0){
+            obj->txMailboxes[aMailBox].dropCount++; // previous message not submitted yet
+        }
+        for(i = 0; i < len; i++){
+            txMsg->data[i]  = data[i];
+        }
+        obj->txStagedFlags |= mask;
+        EINT;
+        return true;
+    }
+
     if((MCAN_getTxBufReqPend(obj->portHandle) & obj->txMailboxes[aMailBox].mask) != 0){
+      obj->txMailboxes[aMailBox].dropCount++;
       return false;
     }
 
-    MCAN_TxBufElement *txMsg = &obj->txMailboxes[aMailBox].buf;
-    int i;
     for(i = 0; i < len; i++){
         txMsg->data[i]  = data[i];
     }
@@ -387,6 +494,108 @@ bool PLX_MCAN_putMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, const uns
     if (MCAN_txBufAddReq(obj->portHandle, aMailBox) == STW_SOK){
         return true;
     } else {
+        obj->txMailboxes[aMailBox].dropCount++;
         return false;
     }
 }
+
+void PLX_MCAN_flushTx(PLX_MCAN_Handle_t aHandle){
+    PLX_MCAN_Obj_t *obj = (PLX_MCAN_Obj_t *)aHandle;
+
+    PLX_ASSERT(obj->txMode == PLX_MCAN_TX_QUEUE);
+
+    if(obj->txStagedFlags == 0){
+        return;
+    }
+
+    int i;
+    if(!PLX_MCAN_isBusOn(aHandle)){
+        DINT;
+        for(i=0; i<obj->numTxPrio; i++){
+            PLX_MCAN_TxMailbox_t *mbox = &obj->txMailboxes[obj->txPrio[i]];
+            if((obj->txStagedFlags & mbox->mask) != 0){
+                mbox->dropCount++;
+            }
+        }
+        obj->txStagedFlags = 0;
+        EINT;
+        return;
+    }
+
+    // any queue element without pending request can be used
+    uint32_t freeBufs = ~MCAN_getTxBufReqPend(obj->portHandle) & MCAN_TX_BUFF_MASK;
+    uint32_t addReq = 0;
+    uint16_t buf = 0;
+
+    // highest priority first, what does not fit stays staged for the next call
+    for(i=0; (i<obj->numTxPrio) && (freeBufs != 0); i++){
+        PLX_MCAN_TxMailbox_t *mbox = &obj->txMailboxes[obj->txPrio[i]];
+        if((obj->txStagedFlags & mbox->mask) == 0){
+            continue;
+        }
+        while((freeBufs & ((uint32_t)1U << buf)) == 0){
+            buf++;
+        }
+        DINT; // PLX_MCAN_putMessage() may be called from a different task
+        MCAN_writeMsgRam(obj->portHandle, MCAN_MEM_TYPE_BUF, buf, &mbox->buf);
+        obj->txStagedFlags &= ~mbox->mask;
+        EINT;
+        freeBufs &= ~((uint32_t)1U << buf);
+        addReq |= ((uint32_t)1U << buf);
+    }
+
+    if(addReq != 0){
+        HW_WR_REG32(obj->portHandle + MCAN_TXBAR, addReq);
+    }
+}
+
+uint32_t PLX_MCAN_getTxDropCount(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox){
+    PLX_MCAN_Obj_t *obj = (PLX_MCAN_Obj_t *)aHandle;
+    PLX_ASSERT(aMailBox < obj->numTxMailboxes);
+
+    return obj->txMailboxes[aMailBox].dropCount;
+}
+
+void PLX_MCAN_poll(PLX_MCAN_Handle_t aHandle){
+    PLX_MCAN_Obj_t *obj = (PLX_MCAN_Obj_t *)aHandle;
+
+    PLX_ASSERT(obj->rxMode != PLX_MCAN_RX_BUFFERS);
+
+    // one status read per tick serves all mailboxes
+    MCAN_ProtocolStatus protStatus;
+    MCAN_getProtocolStatus(obj->portHandle, &protStatus);
+    obj->busOn = (MCAN_OPERATION_MODE_NORMAL == MCAN_getOpMode(obj->portHandle)) &&
+            (protStatus.busOffStatus == 0);
+    obj->errorActive = (protStatus.errPassive == 0);
+    if(!obj->busOn){
+        return;
+    }
+
+    MCAN_RxFIFOStatus fifoStatus = {0};
+    if(obj->rxMode == PLX_MCAN_RX_FIFO_1){
+        fifoStatus.num = MCAN_RX_FIFO_NUM_1;
+    } else {
+        fifoStatus.num = MCAN_RX_FIFO_NUM_0;
+    }
+    MCAN_getRxFIFOStatus(obj->portHandle, &fifoStatus);
+
+    // dispatch all pending elements to their mailboxes, later messages overwrite earlier ones
+    MCAN_RxBufElement *rxMsg = &obj->rxFifoElement;
+    uint32_t idx = fifoStatus.getIdx;
+    uint32_t n;
+    for(n=0; n<fifoStatus.fillLvl; n++){
+        MCAN_readMsgRam(obj->portHandle, MCAN_MEM_TYPE_FIFO, 0, fifoStatus.num, rxMsg);
+        (void)MCAN_writeRxFIFOAck(obj->portHandle, fifoStatus.num, idx);
+        idx = (idx + 1) % MCAN_RX_FIFO_SIZE;
+
+        if(rxMsg->fidx < obj->numRxMailboxes){
+            PLX_MCAN_RxMailbox_t *mbox = &obj->rxMailboxes[rxMsg->fidx];
+            if(mbox->mask){
+                DINT; // PLX_MCAN_getMessage() may be called from a different task
+                mbox->buf = *rxMsg;
+                obj->rxNewFlags |= mbox->mask;
+                EINT;
+            }
+        }
+    }
+}
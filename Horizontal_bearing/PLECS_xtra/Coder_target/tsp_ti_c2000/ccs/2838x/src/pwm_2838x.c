@@ -21,103 +21,33 @@
 #include "plx_pwm.h"
 #include "f2838x_gpio_defines.h"
 
-#pragma diag_suppress 112 // PLX_ASSERT(0) in switch statements
+// register bases, indexed by PLX_PWM_Unit_t
+static volatile struct EPWM_REGS * const PLX_PWM_RegBase[PLX_PWM_EPWM_MAX_PLUS_ONE] = {
+    0,
+    &EPwm1Regs, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs,
+    &EPwm5Regs, &EPwm6Regs, &EPwm7Regs, &EPwm8Regs,
+    &EPwm9Regs, &EPwm10Regs, &EPwm11Regs, &EPwm12Regs,
+    &EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
 
 void PLX_PWM_sinit()
 {
-	EALLOW;
-	CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM2 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM3 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM4 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM5 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM6 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM7 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM8 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM9 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM10 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM11 = 1;
-	CpuSysRegs.PCLKCR2.bit.EPWM12 = 1;
-    CpuSysRegs.PCLKCR2.bit.EPWM13 = 1;
-    CpuSysRegs.PCLKCR2.bit.EPWM14 = 1;
-    CpuSysRegs.PCLKCR2.bit.EPWM15 = 1;
-    CpuSysRegs.PCLKCR2.bit.EPWM16 = 1;
+    uint16_t unit;
+
+    PLX_PWM_enableAllClocks();
 
     // enable larger period counter
-    EPwm1Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm2Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm3Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm4Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm5Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm6Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm7Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm8Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm9Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm10Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm11Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm12Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm13Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm14Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm15Regs.ETPS.bit.SOCPSSEL = 1;
-    EPwm15Regs.ETPS.bit.SOCPSSEL = 1;
-	EDIS;
+    EALLOW;
+    for(unit = PLX_PWM_EPWM1; unit < PLX_PWM_EPWM_MAX_PLUS_ONE; unit++)
+    {
+        PLX_PWM_RegBase[unit]->ETPS.bit.SOCPSSEL = 1;
+    }
+    EDIS;
 }
 
 void PLX_PWM_getRegisterBase(PLX_PWM_Unit_t aPwmChannel, volatile struct EPWM_REGS** aReg){
-	switch(aPwmChannel)
-	{
-		default:
-			PLX_ASSERT(0);
-			break;
-		case PLX_PWM_EPWM1:
-			*aReg = &EPwm1Regs;
-			break;
-		case PLX_PWM_EPWM2:
-			*aReg = &EPwm2Regs;
-			break;
-		case PLX_PWM_EPWM3:
-			*aReg = &EPwm3Regs;
-			break;
-		case PLX_PWM_EPWM4:
-			*aReg = &EPwm4Regs;
-			break;
-		case PLX_PWM_EPWM5:
-			*aReg = &EPwm5Regs;
-			break;
-		case PLX_PWM_EPWM6:
-			*aReg = &EPwm6Regs;
-			break;
-		case PLX_PWM_EPWM7:
-			*aReg = &EPwm7Regs;
-			break;
-		case PLX_PWM_EPWM8:
-			*aReg = &EPwm8Regs;
-			break;
-		case PLX_PWM_EPWM9:
-			*aReg = &EPwm9Regs;
-			break;
-		case PLX_PWM_EPWM10:
-			*aReg = &EPwm10Regs;
-			break;
-		case PLX_PWM_EPWM11:
-			*aReg = &EPwm11Regs;
-			break;
-		case PLX_PWM_EPWM12:
-			*aReg = &EPwm12Regs;
-			break;
-        case PLX_PWM_EPWM13:
-            *aReg = &EPwm9Regs;
-            break;
-        case PLX_PWM_EPWM14:
-            *aReg = &EPwm10Regs;
-            break;
-        case PLX_PWM_EPWM15:
-            *aReg = &EPwm11Regs;
-            break;
-        case PLX_PWM_EPWM16:
-            *aReg = &EPwm12Regs;
-            break;
-	}
+    PLX_ASSERT((aPwmChannel > PLX_PWM_EPWM_NONE) && (aPwmChannel < PLX_PWM_EPWM_MAX_PLUS_ONE));
+    *aReg = PLX_PWM_RegBase[aPwmChannel];
 }
 
 void PLX_PWM_setDefaultParams(PLX_PWM_Params_t *aParams)
@@ -163,6 +93,29 @@ PLX_PWM_Handle_t PLX_PWM_init(void *aMemory, const size_t aNumBytes)
 	return handle;
 }
 
+void PLX_PWM_initGroup(PLX_PWM_Group_t *aGroup)
+{
+    aGroup->numModules = 0;
+}
+
+void PLX_PWM_addToGroup(PLX_PWM_Group_t *aGroup, PLX_PWM_Handle_t aHandle)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+
+    // keep a single write per module
+    uint16_t i;
+    for(i=0; i<aGroup->numModules; i++)
+    {
+        if(aGroup->pwm[i] == obj->pwm)
+        {
+            return;
+        }
+    }
+    PLX_ASSERT(aGroup->numModules < (PLX_PWM_EPWM_MAX_PLUS_ONE-1));
+    aGroup->pwm[aGroup->numModules] = obj->pwm;
+    aGroup->numModules++;
+}
+
 void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_PWM_Params_t *aParams)
 {
 	PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
@@ -220,6 +173,40 @@ void PLX_PWM_configure(PLX_PWM_Handle_t aHandle, uint16_t aModulator, const PLX_
 	EDIS;
 
 	obj->sequence = 1;
+	obj->unit = aModulator;
+	obj->upDown = (aParams->reg.TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN);
+	obj->tbprd = aParams->reg.TBPRD;
+	obj->polSel = aParams->reg.DBCTL.bit.POLSEL;
+	obj->fullDutyCompare = obj->upDown ? (float)aParams->reg.TBPRD : (float)aParams->reg.TBPRD + 1.0;
+	PLX_PWM_updateDutyScaling(aHandle);
+}
+
+void PLX_PWM_enableGlobalLoad(PLX_PWM_Handle_t aHandle, PLX_PWM_Handle_t aMaster)
+{
+    PLX_PWM_Obj_t *obj = (PLX_PWM_Obj_t *)aHandle;
+    PLX_PWM_Obj_t *master = (PLX_PWM_Obj_t *)aMaster;
+
+    EALLOW;
+    // shadow dead-time so that it is transferred with period and compare
+    obj->pwm->DBCTL.bit.SHDWDBREDMODE = 1;
+    obj->pwm->DBCTL.bit.SHDWDBFEDMODE = 1;
+
+    obj->pwm->GLDCFG.all = 0;
+    obj->pwm->GLDCFG.bit.TBPRD_TBPRDHR = 1;
+    obj->pwm->GLDCFG.bit.CMPA_CMPAHR = 1;
+    obj->pwm->GLDCFG.bit.DBRED_DBREDHR = 1;
+    obj->pwm->GLDCFG.bit.DBFED_DBFEDHR = 1;
+
+    obj->pwm->GLDCTL.bit.GLDMODE = 0; // load at CTR=0
+    obj->pwm->GLDCTL.bit.OSHTMODE = 1; // only once armed by PLX_PWM_commitGlobalLoad()
+    obj->pwm->GLDCTL.bit.GLD = 1;
+
+    // one-shot request of the master arms this module as well
+    obj->pwm->EPWMXLINK.bit.GLDCTL2LINK = master->unit - 1;
+
+    // transfer values staged during configuration
+    obj->pwm->GLDCTL2.bit.GFRCLD = 1;
+    EDIS;
 }
 
 void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
@@ -229,7 +216,7 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     PLX_ASSERT(aScalingFactor > 0.0);
 
     float newTBPRD;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         newTBPRD = (float)(obj->nomTBPRD)*aScalingFactor;
@@ -247,7 +234,10 @@ void PLX_PWM_scalePeriod(PLX_PWM_Handle_t aHandle, float aScalingFactor)
     {
         newTBPRD = 65535.0;
     }
-    obj->pwm->TBPRD = (uint16_t)newTBPRD;
+    obj->tbprd = (uint16_t)newTBPRD;
+    obj->pwm->TBPRD = obj->tbprd;
+    obj->fullDutyCompare = obj->upDown ? (float)obj->tbprd : (float)obj->tbprd + 1.0;
+    PLX_PWM_updateDutyScaling(aHandle);
 }
 
 void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
@@ -261,25 +251,25 @@ void PLX_PWM_setPhase(PLX_PWM_Handle_t aHandle, float aPhase)
 
     uint16_t phase;
     uint16_t dir;
-    if(obj->pwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    if(obj->upDown)
     {
         // up-down
         if (aPhase <= 0.5)
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (aPhase) * 2);
             dir = 0;
         }
         else
         {
-            phase = (uint16_t)((float)(obj->pwm->TBPRD) * (1-aPhase) * 2);
+            phase = (uint16_t)((float)(obj->tbprd) * (1-aPhase) * 2);
             dir = 1;
         }
     }
     else
     {
         // saw-tooth
-        phase = (uint16_t)(((float)obj->pwm->TBPRD+1) * (1-aPhase));
-        if(phase > obj->pwm->TBPRD)
+        phase = (uint16_t)(((float)obj->tbprd+1) * (1-aPhase));
+        if(phase > obj->tbprd)
         {
             phase = 0;
         }
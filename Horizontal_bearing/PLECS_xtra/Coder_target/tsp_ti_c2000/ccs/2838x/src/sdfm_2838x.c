@@ -0,0 +1,241 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_sdfm.h"
+
+#pragma diag_suppress 112 // PLX_ASSERT(0) in switch statements
+
+// register set of a single filter channel, repeated every PLX_SDFM_CHANNEL_STEP words
+struct PLX_SDFM_CH_REGS {
+	union SDCTLPARM1_REG SDCTLPARM;
+	union SDDFPARM1_REG SDDFPARM;
+	union SDDPARM1_REG SDDPARM;
+	union SDFLT1CMPH1_REG SDFLTCMPH1;
+	union SDFLT1CMPL1_REG SDFLTCMPL1;
+	union SDCPARM1_REG SDCPARM;
+	union SDDATA1_REG SDDATA;
+};
+
+static volatile struct PLX_SDFM_CH_REGS *PLX_SDFM_getChannelRegs(PLX_SDFM_Obj_t *obj, uint16_t aChannel)
+{
+	volatile uint16_t *base = (volatile uint16_t *)&obj->sdfm->SDCTLPARM1;
+	return (volatile struct PLX_SDFM_CH_REGS *)&base[aChannel*PLX_SDFM_CHANNEL_STEP];
+}
+
+// peak filter output for a full scale modulator input
+static uint32_t PLX_SDFM_getFullScale(PLX_SDFM_FilterType_t aType, uint16_t aOsr)
+{
+	uint32_t osr = aOsr;
+	uint32_t fullScale = 1;
+	switch(aType)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case PLX_SDFM_SINCFAST:
+			fullScale = 2*osr*osr;
+			break;
+
+		case PLX_SDFM_SINC1:
+			fullScale = osr;
+			break;
+
+		case PLX_SDFM_SINC2:
+			fullScale = osr*osr;
+			break;
+
+		case PLX_SDFM_SINC3:
+			fullScale = osr*osr*osr;
+			break;
+	}
+	return fullScale;
+}
+
+// the comparator filter output is unsigned, zero input corresponds to half scale
+static uint16_t PLX_SDFM_getThreshold(float aLevel, uint32_t aFullScale)
+{
+	float threshold = (aLevel + 1.0f) * 0.5f * (float)aFullScale;
+	if(threshold <= 0.0f)
+	{
+		return 0;
+	}
+	if(threshold >= (float)0x7FFF)
+	{
+		return 0x7FFF;
+	}
+	return (uint16_t)threshold;
+}
+
+PLX_SDFM_Handle_t PLX_SDFM_init(void *aMemory, const size_t aNumBytes)
+{
+	if(aNumBytes < sizeof(PLX_SDFM_Obj_t))
+	{
+		return((PLX_SDFM_Handle_t)NULL);
+	}
+	PLX_SDFM_Handle_t handle = (PLX_SDFM_Handle_t)aMemory;
+	return handle;
+}
+
+void PLX_SDFM_configure(PLX_SDFM_Handle_t aHandle, PLX_SDFM_Unit_t aUnit)
+{
+	PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+
+	EALLOW;
+	switch(aUnit)
+	{
+		default:
+			PLX_ASSERT(0);
+			break;
+
+		case PLX_SDFM_SD1:
+			CpuSysRegs.PCLKCR6.bit.SD1 = 1;
+			obj->sdfm = &Sdfm1Regs;
+			break;
+
+		case PLX_SDFM_SD2:
+			CpuSysRegs.PCLKCR6.bit.SD2 = 1;
+			obj->sdfm = &Sdfm2Regs;
+			break;
+	}
+	EDIS;
+
+	obj->unit = aUnit;
+	obj->channelMask = 0;
+	obj->dma = NULL;
+
+	// 16-bit results are found in the upper half of the SDDATAx registers
+	obj->results = (volatile int16_t *)&obj->sdfm->SDDATA1 + 1;
+	obj->resultStep = PLX_SDFM_CHANNEL_STEP;
+
+	uint16_t i;
+	for(i=0; i<PLX_SDFM_NUM_CHANNELS; i++)
+	{
+		obj->scale[i] = 0;
+		obj->offset[i] = 0;
+	}
+}
+
+void PLX_SDFM_setDefaultChannelParams(PLX_SDFM_ChannelParams_t *aParams)
+{
+	aParams->filterType = PLX_SDFM_SINC3;
+	aParams->osr = 128;
+	aParams->scale = 1.0;
+	aParams->offset = 0.0;
+	aParams->compEnable = false;
+	aParams->compFilterType = PLX_SDFM_SINC3;
+	aParams->compOsr = 32;
+	aParams->compHigh = 1.0;
+	aParams->compLow = -1.0;
+}
+
+void PLX_SDFM_setupChannel(PLX_SDFM_Handle_t aHandle, uint16_t aChannel, const PLX_SDFM_ChannelParams_t *aParams)
+{
+	PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+
+	PLX_ASSERT(aChannel < PLX_SDFM_NUM_CHANNELS);
+	PLX_ASSERT((aParams->osr >= 1) && (aParams->osr <= 256));
+
+	volatile struct PLX_SDFM_CH_REGS *ch = PLX_SDFM_getChannelRegs(obj, aChannel);
+
+	// smallest shift for which the full scale fits into a 16-bit result
+	uint32_t fullScale = PLX_SDFM_getFullScale(aParams->filterType, aParams->osr);
+	uint16_t shift = 0;
+	while((fullScale >> shift) > 0x7FFF)
+	{
+		shift++;
+	}
+
+	EALLOW;
+	// modulator clock equals data rate, own clock input
+	ch->SDCTLPARM.bit.MOD = 0;
+	ch->SDCTLPARM.bit.SDCLKSEL = 0;
+	ch->SDCTLPARM.bit.SDCLKSYNC = 1;
+	ch->SDCTLPARM.bit.SDDATASYNC = 1;
+
+	ch->SDDFPARM.bit.DOSR = aParams->osr - 1;
+	ch->SDDFPARM.bit.SST = aParams->filterType;
+	ch->SDDFPARM.bit.AE = 1; // data ready event, used as DMA trigger
+	ch->SDDPARM.bit.DR = 0; // 16-bit results
+	ch->SDDPARM.bit.SH = shift;
+
+	if(aParams->compEnable)
+	{
+		PLX_ASSERT((aParams->compOsr >= 1) && (aParams->compOsr <= 32));
+		uint32_t compFullScale = PLX_SDFM_getFullScale(aParams->compFilterType, aParams->compOsr);
+
+		ch->SDCPARM.bit.COSR = aParams->compOsr - 1;
+		ch->SDCPARM.bit.CS1_CS0 = aParams->compFilterType;
+		ch->SDFLTCMPH1.bit.HLT = PLX_SDFM_getThreshold(aParams->compHigh, compFullScale);
+		ch->SDFLTCMPL1.bit.LLT = PLX_SDFM_getThreshold(aParams->compLow, compFullScale);
+		// CEVT1 = COMPH1, CEVT2 = COMPL1, passed to the X-BAR unfiltered (SDCOMPxCTL reset state)
+		ch->SDCPARM.bit.CEVT1SEL = 0;
+		ch->SDCPARM.bit.CEVT2SEL = 0;
+		ch->SDCPARM.bit.CEN = 1;
+	}
+
+	ch->SDDFPARM.bit.FEN = 1;
+	EDIS;
+
+	obj->scale[aChannel] = aParams->scale * (float)((uint32_t)1 << shift) / (float)fullScale;
+	obj->offset[aChannel] = aParams->offset;
+	obj->channelMask |= (1 << aChannel);
+}
+
+void PLX_SDFM_enable(PLX_SDFM_Handle_t aHandle)
+{
+	PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+
+	EALLOW;
+	obj->sdfm->SDMFILEN.bit.MFE = 1;
+	EDIS;
+}
+
+void PLX_SDFM_setupDma(PLX_SDFM_Handle_t aHandle, uint16_t aDmaChannel, uint16_t aTriggerChannel, int16_t *aResults)
+{
+	PLX_SDFM_Obj_t *obj = (PLX_SDFM_Obj_t *)aHandle;
+
+	PLX_ASSERT(aTriggerChannel < PLX_SDFM_NUM_CHANNELS);
+	PLX_ASSERT(obj->channelMask & (1 << aTriggerChannel));
+
+	// the DMA buffer is not initialized at startup
+	uint16_t i;
+	for(i=0; i<PLX_SDFM_NUM_CHANNELS; i++)
+	{
+		aResults[i] = 0;
+	}
+
+	obj->dma = PLX_DMA_init(&obj->dmaObj, sizeof(obj->dmaObj));
+
+	// one burst collects the results of all channels
+	PLX_DMA_Params_t params;
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = PLX_DMA_TRIGGER_SD1FLT1 + PLX_SDFM_NUM_CHANNELS*(uint16_t)obj->unit + aTriggerChannel;
+	params.srcAddr = (volatile uint16_t *)obj->results;
+	params.srcBurstStep = PLX_SDFM_CHANNEL_STEP;
+	params.dstAddr = (volatile uint16_t *)aResults;
+	params.burstSize = PLX_SDFM_NUM_CHANNELS;
+	params.continuous = true;
+	PLX_DMA_configure(obj->dma, aDmaChannel, &params);
+
+	obj->results = aResults;
+	obj->resultStep = 1;
+
+	PLX_DMA_start(obj->dma);
+}
@@ -97,6 +97,162 @@ void PLX_SPI_setupPort(PLX_SPI_Handle_t aHandle, PLX_SPI_Params_t *aParams)
 	EDIS;
 }
 
+void PLX_SPI_setupDmaFrames(PLX_SPI_Handle_t aHandle, uint16_t aTxDmaChannel, uint16_t aRxDmaChannel, uint16_t aTrigger, uint16_t *aTxFrame, uint16_t *aRxFrames, uint16_t aFrameSize)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	PLX_ASSERT((aFrameSize >= 1) && (aFrameSize <= PLX_SPI_FIFO_DEPTH));
+
+	obj->dmaTxFrame = aTxFrame;
+	obj->dmaRxFrames = aRxFrames;
+	obj->dmaFrameSize = aFrameSize;
+	obj->dmaRxBank = 1;
+
+	// the DMA buffers are not initialized at startup
+	uint16_t i;
+	for(i=0; i<aFrameSize; i++)
+	{
+		aTxFrame[i] = 0;
+		aRxFrames[i] = 0;
+		aRxFrames[aFrameSize + i] = 0;
+	}
+
+	EALLOW;
+	// RX DMA event once the complete frame has been received
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIL = aFrameSize;
+	EDIS;
+
+	// one burst per trigger pushes the whole frame into the TX FIFO
+	PLX_DMA_Params_t params;
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = aTrigger;
+	params.srcAddr = aTxFrame;
+	params.dstAddr = &PLX_SPI_REGS_PTR->SPITXBUF;
+	params.burstSize = aFrameSize;
+	params.transferSize = 1;
+	params.dstBurstStep = 0;
+	params.dstTransferStep = 0;
+	params.continuous = true;
+
+	obj->dmaTx = PLX_DMA_init(&obj->dmaTxObj, sizeof(obj->dmaTxObj));
+	PLX_DMA_configure(obj->dmaTx, aTxDmaChannel, &params);
+
+	// received frames alternate between the two banks (ping-pong)
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = PLX_DMA_TRIGGER_SPIA_RX + 2*(uint16_t)obj->unit;
+	params.srcAddr = &PLX_SPI_REGS_PTR->SPIRXBUF;
+	params.dstAddr = aRxFrames;
+	params.burstSize = aFrameSize;
+	params.transferSize = 2;
+	params.srcBurstStep = 0;
+	params.srcTransferStep = 0;
+	params.continuous = true;
+
+	obj->dmaRx = PLX_DMA_init(&obj->dmaRxObj, sizeof(obj->dmaRxObj));
+	PLX_DMA_configure(obj->dmaRx, aRxDmaChannel, &params);
+}
+
+void PLX_SPI_setupDmaSlaveFrames(PLX_SPI_Handle_t aHandle, uint16_t aTxDmaChannel, uint16_t aRxDmaChannel, uint16_t aSteGpio, uint16_t *aTxFrame, uint16_t *aRxFrames, uint16_t aFrameSize)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	PLX_ASSERT((aFrameSize >= 1) && (aFrameSize <= PLX_SPI_FIFO_DEPTH));
+
+	obj->dmaTxFrame = aTxFrame;
+	obj->dmaRxFrames = aRxFrames;
+	obj->dmaFrameSize = aFrameSize;
+	obj->dmaRxBank = 0;
+	obj->dmaRxLatest = 1;
+	obj->dmaFrameCount = 0;
+	obj->dmaFrameCountRead = 0;
+	obj->dmaFramingErrorCount = 0;
+
+	// the DMA buffers are not initialized at startup
+	uint16_t i;
+	for(i=0; i<aFrameSize; i++)
+	{
+		aTxFrame[i] = 0;
+		aRxFrames[i] = 0;
+		aRxFrames[aFrameSize + i] = 0;
+	}
+
+	// read back of the /CS (STE) pin for frame alignment checks
+	PLX_DIO_InputProperties_t props = {0};
+	props.enableInvert = false;
+	obj->ste = PLX_DIO_init(&obj->steObj, sizeof(obj->steObj));
+	PLX_DIO_configureIn(obj->ste, aSteGpio, &props);
+
+	EALLOW;
+	// RX DMA event once the complete frame has been received
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIL = aFrameSize;
+	// TX DMA event once the previous frame has been shifted out
+	PLX_SPI_REGS_PTR->SPIFFTX.bit.TXFFIL = 0;
+	EDIS;
+
+	// the next frame is waiting in the TX FIFO before the master selects us
+	PLX_DMA_Params_t params;
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = PLX_DMA_TRIGGER_SPIA_TX + 2*(uint16_t)obj->unit;
+	params.srcAddr = aTxFrame;
+	params.dstAddr = &PLX_SPI_REGS_PTR->SPITXBUF;
+	params.burstSize = aFrameSize;
+	params.transferSize = 1;
+	params.dstBurstStep = 0;
+	params.dstTransferStep = 0;
+	params.continuous = true;
+
+	obj->dmaTx = PLX_DMA_init(&obj->dmaTxObj, sizeof(obj->dmaTxObj));
+	PLX_DMA_configure(obj->dmaTx, aTxDmaChannel, &params);
+
+	// one transfer per frame, PLX_SPI_dmaSlaveRxIsr() selects the next bank
+	PLX_DMA_setDefaultParams(&params);
+	params.trigger = PLX_DMA_TRIGGER_SPIA_RX + 2*(uint16_t)obj->unit;
+	params.srcAddr = &PLX_SPI_REGS_PTR->SPIRXBUF;
+	params.dstAddr = aRxFrames;
+	params.burstSize = aFrameSize;
+	params.transferSize = 1;
+	params.srcBurstStep = 0;
+	params.srcTransferStep = 0;
+	params.continuous = true;
+	params.interruptAtEnd = true;
+
+	obj->dmaRx = PLX_DMA_init(&obj->dmaRxObj, sizeof(obj->dmaRxObj));
+	PLX_DMA_configure(obj->dmaRx, aRxDmaChannel, &params);
+}
+
+#pragma CODE_SECTION(PLX_SPI_dmaSlaveRxIsr, "ramfuncs")
+void PLX_SPI_dmaSlaveRxIsr(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	// the next frame goes to the other bank
+	uint16_t bank = obj->dmaRxBank;
+	obj->dmaRxBank = bank ^ 1;
+	PLX_DMA_setNextDstAddr(obj->dmaRx, &obj->dmaRxFrames[(bank ^ 1)*obj->dmaFrameSize]);
+
+	// words left while /CS is released: the master did not send whole frames
+	if(PLX_DIO_get(obj->ste) && (PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFST != 0))
+	{
+		// drop the misaligned frame and resynchronize with the next one
+		obj->dmaFramingErrorCount++;
+		PLX_SPI_resetFifos(aHandle);
+		return;
+	}
+
+	obj->dmaRxLatest = bank;
+	obj->dmaFrameCount++;
+}
+
+void PLX_SPI_startDmaFrames(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	PLX_SPI_resetFifos(aHandle);
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFOVFCLR = 1;
+	PLX_DMA_start(obj->dmaRx);
+	PLX_DMA_start(obj->dmaTx);
+}
+
 void PLX_SPI_putGetWords(PLX_SPI_Handle_t aHandle, uint16_t *aOutData, uint16_t *aInData, uint16_t aLen){
     PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
 
@@ -115,3 +271,93 @@ void PLX_SPI_putGetWords(PLX_SPI_Handle_t aHandle, uint16_t *aOutData, uint16_t
     }
 }
 
+void PLX_SPI_setupTransactions(PLX_SPI_Handle_t aHandle, const PLX_SPI_Transaction_t *aTable, uint16_t aNumTransactions)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	obj->trans = aTable;
+	obj->numTrans = aNumTransactions;
+	obj->transBusy = false;
+
+	uint16_t i;
+	for(i=0; i<aNumTransactions; i++)
+	{
+		PLX_ASSERT((aTable[i].len >= 1) && (aTable[i].len <= PLX_SPI_FIFO_DEPTH));
+		PLX_DIO_set(aTable[i].cs, true);
+	}
+}
+
+#pragma CODE_SECTION(PLX_SPI_loadTransaction, "ramfuncs")
+static void PLX_SPI_loadTransaction(PLX_SPI_Obj_t *obj)
+{
+	const PLX_SPI_Transaction_t *t = &obj->trans[obj->transIndex];
+	uint16_t *txData = &obj->transTxData[obj->transOffset];
+
+	// interrupt once the last word of this slave has been clocked in
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIL = t->len;
+	PLX_DIO_set(t->cs, false);
+
+	uint16_t i;
+	for(i=0; i<t->len; i++)
+	{
+		PLX_SPI_REGS_PTR->SPITXBUF = (txData[i] << obj->txShift);
+	}
+}
+
+#pragma CODE_SECTION(PLX_SPI_startTransactions, "ramfuncs")
+bool PLX_SPI_startTransactions(PLX_SPI_Handle_t aHandle, uint16_t *aTxData, uint16_t *aRxData)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+
+	if(obj->transBusy || (obj->numTrans == 0))
+	{
+		return false;
+	}
+
+	PLX_SPI_resetFifos(aHandle);
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFOVFCLR = 1;
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFINTCLR = 1;
+
+	obj->transTxData = aTxData;
+	obj->transRxData = aRxData;
+	obj->transIndex = 0;
+	obj->transOffset = 0;
+	obj->transBusy = true;
+	PLX_SPI_loadTransaction(obj);
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIENA = 1;
+	return true;
+}
+
+bool PLX_SPI_transactionsBusy(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+	return obj->transBusy;
+}
+
+#pragma CODE_SECTION(PLX_SPI_transactionIsr, "ramfuncs")
+void PLX_SPI_transactionIsr(PLX_SPI_Handle_t aHandle)
+{
+	PLX_SPI_Obj_t *obj = (PLX_SPI_Obj_t *)aHandle;
+	const PLX_SPI_Transaction_t *t = &obj->trans[obj->transIndex];
+	uint16_t *rxData = &obj->transRxData[obj->transOffset];
+
+	uint16_t i;
+	for(i=0; i<t->len; i++)
+	{
+		rxData[i] = PLX_SPI_REGS_PTR->SPIRXBUF & obj->rxMask;
+	}
+	PLX_DIO_set(t->cs, true);
+
+	obj->transOffset += t->len;
+	obj->transIndex++;
+	if(obj->transIndex < obj->numTrans)
+	{
+		PLX_SPI_loadTransaction(obj);
+	}
+	else
+	{
+		PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFIENA = 0;
+		obj->transBusy = false;
+	}
+	PLX_SPI_REGS_PTR->SPIFFRX.bit.RXFFINTCLR = 1;
+}
@@ -37,6 +37,8 @@ $(BASE_NAME)_hal.c \
 $(BASE_NAME)_main.c\
 dispatcher.c \
 power.c \
+svm.c \
+xcp.c \
 f2838x_devinit.c\
 f2838x_globalvariabledefs.c\
 f2838x_adc.c\
@@ -49,7 +51,11 @@ qep_2838x.c \
 cap_2838x.c \
 canbus_2838x.c \
 mcan_2838x.c \
-spi_2838x.c
+spi_2838x.c \
+dma_2838x.c \
+fsi_2838x.c \
+sdfm_2838x.c \
+i2c_2838x.c
 
 CLA_SOURCE_FILES=\
 $(BASE_NAME)_cla.cla
@@ -184,6 +190,12 @@ $(BIN_DIR)/dispatcher.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/dispatche
 $(BIN_DIR)/power.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/power.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/svm.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/svm.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/xcp.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/../shrd/xcp.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/f2838x_adc.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/tisrc/f2838x_adc.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
@@ -217,6 +229,18 @@ $(BIN_DIR)/sci_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/sci_2838x.c $(
 $(BIN_DIR)/spi_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/spi_2838x.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 
+$(BIN_DIR)/dma_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/dma_2838x.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/fsi_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/fsi_2838x.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/sdfm_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/sdfm_2838x.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
+$(BIN_DIR)/i2c_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/i2c_2838x.c $(HFILES)
+						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
+
 $(BIN_DIR)/dac_2838x.obj:	$(call EscapeSpaces,$(TARGET_ROOT))/src/dac_2838x.c $(HFILES)
 						"$(CGT_EXE_PATH)"/cl2000 $(C_OPTIONS) "$<"
 						
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+/*
+ * Three-phase NPC (two modules per phase) and four-module stacks, updated
+ * either per module as before, with the band mapping done by the model and
+ * one PLX_PWM_setPwmDuty() per module, or with one
+ * PLX_SVM_setMultiLevelDutyN() call. Both paths must produce the same
+ * compare registers; the time per update is reported for comparison.
+ *
+ * The times are those of the host CPU and only indicate the relative cost
+ * of the two paths, C28x cycle counts have to be taken on the target.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include "plx_svm.h"
+#include "test.h"
+
+#define NUM_PHASES 3
+#define NUM_REFS 256
+#define NUM_ROUNDS 20000
+
+static PLX_PWM_Obj_t Obj[NUM_PHASES * PLX_SVM_MAX_LEVEL_MODULES];
+static PLX_PWM_Handle_t Handles[NUM_PHASES * PLX_SVM_MAX_LEVEL_MODULES];
+static float Refs[NUM_REFS][NUM_PHASES];
+
+// model-side band mapping followed by one driver call per module
+static void perModuleUpdate(const float *aRefs, uint16_t aModules)
+{
+    uint16_t p, k;
+    for(p=0; p<NUM_PHASES; p++)
+    {
+        for(k=0; k<aModules; k++)
+        {
+            float duty = (aRefs[p] + 1.0f) * 0.5f * (float)aModules - (float)k;
+            PLX_PWM_setPwmDuty(Handles[p * aModules + k], duty);
+        }
+    }
+}
+
+static double seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+}
+
+static void run(uint16_t aModules)
+{
+    uint32_t expected[NUM_PHASES * PLX_SVM_MAX_LEVEL_MODULES];
+    uint16_t numHandles = NUM_PHASES * aModules;
+    double start, perModule, multiLevel;
+    int r, i, n;
+
+    // equivalence for each reference set
+    for(r=0; r<NUM_REFS; r++)
+    {
+        perModuleUpdate(Refs[r], aModules);
+        for(i=0; i<numHandles; i++)
+        {
+            expected[i] = Obj[i].pwm->CMPA.all;
+        }
+        PLX_SVM_setMultiLevelDutyN(Handles, Refs[r], NUM_PHASES, aModules);
+        for(i=0; i<numHandles; i++)
+        {
+            CHECK(Obj[i].pwm->CMPA.all == expected[i],
+                  "%u modules, reference set %d, module %d: 0x%08x, per module 0x%08x",
+                  aModules, r, i, (unsigned)Obj[i].pwm->CMPA.all, (unsigned)expected[i]);
+        }
+    }
+
+    start = seconds();
+    for(n=0; n<NUM_ROUNDS; n++)
+    {
+        for(r=0; r<NUM_REFS; r++)
+        {
+            perModuleUpdate(Refs[r], aModules);
+        }
+    }
+    perModule = (seconds() - start) / ((double)NUM_ROUNDS * NUM_REFS);
+
+    start = seconds();
+    for(n=0; n<NUM_ROUNDS; n++)
+    {
+        for(r=0; r<NUM_REFS; r++)
+        {
+            PLX_SVM_setMultiLevelDutyN(Handles, Refs[r], NUM_PHASES, aModules);
+        }
+    }
+    multiLevel = (seconds() - start) / ((double)NUM_ROUNDS * NUM_REFS);
+
+    printf("%u modules per phase: per module %.1f ns, multi-level %.1f ns per update (%.2fx)\n",
+           aModules, perModule * 1.0e9, multiLevel * 1.0e9, perModule / multiLevel);
+}
+
+int main(void)
+{
+    PLX_PWM_Params_t params;
+    uint16_t modules;
+    int i, r;
+
+    PLX_PWM_sinit();
+    PLX_PWM_setDefaultParams(&params);
+    params.reg.TBPRD = 2500;
+    for(i=0; i<NUM_PHASES * PLX_SVM_MAX_LEVEL_MODULES; i++)
+    {
+        Handles[i] = PLX_PWM_init(&Obj[i], sizeof(Obj[i]));
+        PLX_PWM_configure(Handles[i], PLX_PWM_EPWM1 + i, &params);
+    }
+
+    // balanced three-phase references, slightly overmodulated
+    for(r=0; r<NUM_REFS; r++)
+    {
+        for(i=0; i<NUM_PHASES; i++)
+        {
+            Refs[r][i] = 1.05f * (float)cos(2.0 * M_PI * (r / (double)NUM_REFS - i / 3.0));
+        }
+    }
+
+    for(modules=2; modules<=PLX_SVM_MAX_LEVEL_MODULES; modules++)
+    {
+        run(modules);
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,63 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef _INCLUDES_H_
+#define _INCLUDES_H_
+
+/*
+ * Host replacement of app/includes.h for building the 2838x drivers and the
+ * shared kernels with a native compiler. Peripheral registers are plain
+ * structs in RAM (see regs.c), protected-register access is a no-op.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define TARGET_2838x
+#define CPU1
+
+// fixed-width replacements of the C28x data types
+#define DSP28_DATA_TYPES
+#define F28_DATA_TYPES
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+typedef float float32;
+typedef long double float64;
+
+#define EALLOW
+#define EDIS
+#define EINT
+#define DINT
+#define interrupt
+
+// header functions are defined in every translation unit that uses them
+#define inline static inline
+
+#define PLX_ASSERT(x) assert(x)
+
+#include "f2838x_sysctrl.h"
+#include "f2838x_epwm.h"
+
+#endif // _INCLUDES_H_
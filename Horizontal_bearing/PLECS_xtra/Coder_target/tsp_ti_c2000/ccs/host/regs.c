@@ -0,0 +1,40 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+// RAM-backed register model, placed by the linker command file on the target
+volatile struct CPU_SYS_REGS CpuSysRegs;
+
+volatile struct EPWM_REGS EPwm1Regs;
+volatile struct EPWM_REGS EPwm2Regs;
+volatile struct EPWM_REGS EPwm3Regs;
+volatile struct EPWM_REGS EPwm4Regs;
+volatile struct EPWM_REGS EPwm5Regs;
+volatile struct EPWM_REGS EPwm6Regs;
+volatile struct EPWM_REGS EPwm7Regs;
+volatile struct EPWM_REGS EPwm8Regs;
+volatile struct EPWM_REGS EPwm9Regs;
+volatile struct EPWM_REGS EPwm10Regs;
+volatile struct EPWM_REGS EPwm11Regs;
+volatile struct EPWM_REGS EPwm12Regs;
+volatile struct EPWM_REGS EPwm13Regs;
+volatile struct EPWM_REGS EPwm14Regs;
+volatile struct EPWM_REGS EPwm15Regs;
+volatile struct EPWM_REGS EPwm16Regs;
@@ -0,0 +1,46 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+/*
+ * Checks shared by the host tests. Each test is a single translation unit
+ * that reports failures with CHECK() and ends main() with TEST_RESULT().
+ */
+
+#include <stdio.h>
+
+static int Failures = 0;
+
+// reports a failed condition with a printf-style message and continues
+#define CHECK(cond, ...) do {\
+    if(!(cond)){\
+        printf("FAIL %s:%d: ", __FILE__, __LINE__);\
+        printf(__VA_ARGS__);\
+        printf("\n");\
+        Failures++;\
+    }\
+} while(0)
+
+// prints the summary, evaluates to the exit status of the test
+#define TEST_RESULT() \
+    (printf("%s: %d failure(s)\n", __FILE__, Failures), (Failures == 0) ? 0 : 1)
+
+#endif // _TEST_H_
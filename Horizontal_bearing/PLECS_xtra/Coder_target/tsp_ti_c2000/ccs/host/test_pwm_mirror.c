@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+/*
+ * The PWM object mirrors carrier mode, period and dead-band polarity in RAM.
+ * Every hot-path function that uses the mirror is checked against a
+ * reference that derives the same result from the register model, as the
+ * driver did before the mirror was introduced.
+ */
+
+#include <stdio.h>
+#include "plx_pwm.h"
+#include "test.h"
+
+static uint32_t refFullDutyCompare(volatile struct EPWM_REGS *aPwm)
+{
+    if(aPwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    {
+        return aPwm->TBPRD;
+    }
+    return (uint32_t)aPwm->TBPRD + 1;
+}
+
+static void refPhase(volatile struct EPWM_REGS *aPwm, float aPhase, uint16_t *aTbphs, uint16_t *aDir)
+{
+    uint16_t phase;
+    if((aPhase < 0) || (aPhase >= 1.0))
+    {
+        aPhase = 0;
+    }
+    if(aPwm->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    {
+        if(aPhase <= 0.5)
+        {
+            phase = (uint16_t)((float)(aPwm->TBPRD) * (aPhase) * 2);
+            *aDir = 0;
+        }
+        else
+        {
+            phase = (uint16_t)((float)(aPwm->TBPRD) * (1-aPhase) * 2);
+            *aDir = 1;
+        }
+    }
+    else
+    {
+        phase = (uint16_t)(((float)aPwm->TBPRD+1) * (1-aPhase));
+        if(phase > aPwm->TBPRD)
+        {
+            phase = 0;
+        }
+        *aDir = 0;
+    }
+    *aTbphs = phase;
+}
+
+static void refTransition(volatile struct EPWM_REGS *aPwm, uint16_t aSequence, uint16_t *aRldcsf, uint16_t *aLoadMode)
+{
+    if(aPwm->TBCTL.bit.CTRMODE == TB_COUNT_UP)
+    {
+        *aRldcsf = 1;
+        *aLoadMode = 0;
+    }
+    else if((aPwm->DBCTL.bit.POLSEL == DB_ACTV_HIC) != ((aSequence & 0x01) == 0))
+    {
+        *aRldcsf = 1;
+        *aLoadMode = 1;
+    }
+    else
+    {
+        *aRldcsf = 0;
+        *aLoadMode = 0;
+    }
+}
+
+static uint16_t refCompare(volatile struct EPWM_REGS *aPwm, uint16_t aSequence, float aDuty)
+{
+    float full = (float)refFullDutyCompare(aPwm);
+    float cmp = (aSequence & 1) ? full * aDuty : full - full * aDuty;
+    cmp = (cmp > 65535.0) ? 65535.0 : cmp;
+    return (uint16_t)cmp;
+}
+
+static void checkModule(PLX_PWM_Handle_t aHandle, volatile struct EPWM_REGS *aPwm, const char *aCase)
+{
+    static const float phases[] = {0.0f, 0.1f, 0.25f, 0.5f, 0.75f, 0.999f, 1.0f, -0.2f};
+    static const float duties[] = {0.0f, 0.3f, 0.5f, 0.9f, 1.0f};
+    uint16_t seq;
+    unsigned i;
+
+    CHECK(PLX_PWM_getFullDutyCompare(aHandle) == refFullDutyCompare(aPwm),
+          "%s: full duty compare %u, registers %u", aCase,
+          (unsigned)PLX_PWM_getFullDutyCompare(aHandle), (unsigned)refFullDutyCompare(aPwm));
+
+    for(i=0; i<sizeof(phases)/sizeof(phases[0]); i++)
+    {
+        uint16_t tbphs;
+        uint16_t dir;
+        refPhase(aPwm, phases[i], &tbphs, &dir);
+        PLX_PWM_setPhase(aHandle, phases[i]);
+        CHECK((aPwm->TBPHS.bit.TBPHS == tbphs) && (aPwm->TBCTL.bit.PHSDIR == dir),
+              "%s: phase %f", aCase, phases[i]);
+    }
+
+    for(seq=0; seq<4; seq++)
+    {
+        uint16_t rldcsf, loadMode;
+        PLX_PWM_setSequence(aHandle, seq);
+        refTransition(aPwm, seq, &rldcsf, &loadMode);
+        PLX_PWM_prepareSetOutToXTransition(aHandle);
+        CHECK((aPwm->AQSFRC.bit.RLDCSF == rldcsf) && (aPwm->DBCTL2.bit.LOADDBCTLMODE == loadMode),
+              "%s: transition shadowing, sequence %u", aCase, seq);
+
+        for(i=0; i<sizeof(duties)/sizeof(duties[0]); i++)
+        {
+            PLX_PWM_setPwmDuty(aHandle, duties[i]);
+            CHECK(aPwm->CMPA.bit.CMPA == refCompare(aPwm, seq, duties[i]),
+                  "%s: duty %f, sequence %u", aCase, duties[i], seq);
+        }
+    }
+
+    PLX_PWM_setOutToPassive(aHandle);
+    {
+        uint16_t force = (aPwm->DBCTL.bit.POLSEL == DB_ACTV_LOC) ? 2 : 1;
+        CHECK((aPwm->AQCSFRC.bit.CSFA == force) && (aPwm->AQCSFRC.bit.CSFB == force),
+              "%s: passive state", aCase);
+    }
+    PLX_PWM_setOutToOperational(aHandle);
+}
+
+int main(void)
+{
+    static const uint16_t modes[] = {TB_COUNT_UPDOWN, TB_COUNT_UP};
+    static const uint16_t polarities[] = {DB_ACTV_HIC, DB_ACTV_LOC};
+    static const uint16_t periods[] = {1, 1000, 2499, 65535};
+    static const float scalings[] = {0.5f, 0.9f, 1.0f, 1.37f, 100.0f, 1.0e-6f};
+    unsigned m, p, t, s;
+
+    PLX_PWM_sinit();
+
+    for(m=0; m<2; m++)
+    {
+        for(p=0; p<2; p++)
+        {
+            for(t=0; t<sizeof(periods)/sizeof(periods[0]); t++)
+            {
+                PLX_PWM_Obj_t obj;
+                PLX_PWM_Handle_t handle = PLX_PWM_init(&obj, sizeof(obj));
+                PLX_PWM_Params_t params;
+                char name[64];
+
+                PLX_PWM_setDefaultParams(&params);
+                params.reg.TBCTL.bit.CTRMODE = modes[m];
+                params.reg.DBCTL.bit.POLSEL = polarities[p];
+                params.reg.TBPRD = periods[t];
+                PLX_PWM_configure(handle, PLX_PWM_EPWM1 + t, &params);
+
+                snprintf(name, sizeof(name), "mode %u, polarity %u, period %u",
+                         modes[m], polarities[p], periods[t]);
+                checkModule(handle, obj.pwm, name);
+
+                for(s=0; s<sizeof(scalings)/sizeof(scalings[0]); s++)
+                {
+                    PLX_PWM_scalePeriod(handle, scalings[s]);
+                    snprintf(name, sizeof(name), "mode %u, polarity %u, period %u, scaling %g",
+                             modes[m], polarities[p], periods[t], scalings[s]);
+                    checkModule(handle, obj.pwm, name);
+                }
+            }
+        }
+    }
+
+    return TEST_RESULT();
+}
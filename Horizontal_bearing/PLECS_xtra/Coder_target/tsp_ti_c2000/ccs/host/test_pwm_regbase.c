@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+/*
+ * Register base table of the 2838x PWM driver: every unit resolves to its
+ * own EPwmNRegs, and PLX_PWM_sinit()/PLX_PWM_configure() reach all 16
+ * modules.
+ */
+
+#include <stdio.h>
+#include "plx_pwm.h"
+#include "test.h"
+
+static volatile struct EPWM_REGS * const Expected[PLX_PWM_EPWM_MAX_PLUS_ONE] = {
+    0,
+    &EPwm1Regs, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs,
+    &EPwm5Regs, &EPwm6Regs, &EPwm7Regs, &EPwm8Regs,
+    &EPwm9Regs, &EPwm10Regs, &EPwm11Regs, &EPwm12Regs,
+    &EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
+
+int main(void)
+{
+    volatile struct EPWM_REGS *base[PLX_PWM_EPWM_MAX_PLUS_ONE];
+    PLX_PWM_Params_t params;
+    uint16_t unit, other;
+
+    CHECK(PLX_PWM_EPWM_MAX_PLUS_ONE == 17, "%d units", PLX_PWM_EPWM_MAX_PLUS_ONE - 1);
+
+    for(unit = PLX_PWM_EPWM1; unit < PLX_PWM_EPWM_MAX_PLUS_ONE; unit++)
+    {
+        PLX_PWM_getRegisterBase((PLX_PWM_Unit_t)unit, &base[unit]);
+        CHECK(base[unit] == Expected[unit], "EPWM%u does not map to EPwm%uRegs", unit, unit);
+        for(other = PLX_PWM_EPWM1; other < unit; other++)
+        {
+            CHECK(base[unit] != base[other], "EPWM%u and EPWM%u share a base", unit, other);
+        }
+    }
+
+    // static initialization touches every module exactly once
+    PLX_PWM_sinit();
+    for(unit = PLX_PWM_EPWM1; unit < PLX_PWM_EPWM_MAX_PLUS_ONE; unit++)
+    {
+        CHECK(Expected[unit]->ETPS.bit.SOCPSSEL == 1, "EPWM%u: SOCPSSEL not set", unit);
+    }
+    CHECK((CpuSysRegs.PCLKCR2.all & 0xFFFF) == 0xFFFF, "not all EPWM clocks enabled");
+
+    // configuration lands in the module's own registers only
+    PLX_PWM_setDefaultParams(&params);
+    for(unit = PLX_PWM_EPWM1; unit < PLX_PWM_EPWM_MAX_PLUS_ONE; unit++)
+    {
+        PLX_PWM_Obj_t obj;
+        PLX_PWM_Handle_t handle = PLX_PWM_init(&obj, sizeof(obj));
+        params.reg.TBPRD = 1000 + unit;
+        PLX_PWM_configure(handle, unit, &params);
+        CHECK(obj.pwm == Expected[unit], "EPWM%u: configured handle points elsewhere", unit);
+    }
+    for(unit = PLX_PWM_EPWM1; unit < PLX_PWM_EPWM_MAX_PLUS_ONE; unit++)
+    {
+        CHECK(Expected[unit]->TBPRD == 1000 + unit, "EPWM%u: TBPRD %u", unit, Expected[unit]->TBPRD);
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+/*
+ * PLX_SVM_computeDuties() against a double-precision golden model that
+ * works in polar coordinates: the zero-sequence components are derived
+ * from the phase angle instead of the min/max and product shortcuts used
+ * by the kernel.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "plx_svm.h"
+#include "test.h"
+
+#define TOLERANCE 2.0e-6
+
+static void goldenDuties(PLX_SVM_Mode_t aMode, double aMag, double aTheta, double *aDuties)
+{
+    double v[3], vmax, vmin, v0 = 0.0;
+    int k;
+
+    for(k=0; k<3; k++)
+    {
+        v[k] = aMag * cos(aTheta - k * 2.0 * M_PI / 3.0);
+    }
+    vmax = fmax(v[0], fmax(v[1], v[2]));
+    vmin = fmin(v[0], fmin(v[1], v[2]));
+
+    switch(aMode)
+    {
+        case PLX_SVM_SINE:
+            v0 = 0.0;
+            break;
+        case PLX_SVM_THI:
+            // the kernel skips the injection near the origin
+            v0 = (aMag * aMag > 1.0e-6) ? -aMag / 6.0 * cos(3.0 * aTheta) : 0.0;
+            break;
+        case PLX_SVM_SVPWM:
+            v0 = -0.5 * (vmax + vmin);
+            break;
+        case PLX_SVM_DPWM1:
+            v0 = (fabs(vmax) >= fabs(vmin)) ? (1.0 - vmax) : (-1.0 - vmin);
+            break;
+        case PLX_SVM_DPWMMAX:
+            v0 = 1.0 - vmax;
+            break;
+        case PLX_SVM_DPWMMIN:
+            v0 = -1.0 - vmin;
+            break;
+    }
+    for(k=0; k<3; k++)
+    {
+        aDuties[k] = 0.5 + 0.5 * (v[k] + v0);
+    }
+}
+
+int main(void)
+{
+    static const double mags[] = {0.0, 1.0e-4, 0.1, 0.5, 0.9, 1.0, 1.1547};
+    double maxErr = 0.0;
+    int mode, m, step, k;
+
+    for(mode=PLX_SVM_SINE; mode<=PLX_SVM_DPWMMIN; mode++)
+    {
+        for(m=0; m<sizeof(mags)/sizeof(mags[0]); m++)
+        {
+            // half-degree steps, including the sector boundaries
+            for(step=0; step<720; step++)
+            {
+                double theta = step * M_PI / 360.0;
+                double golden[3];
+                float duties[3];
+
+                if((mode == PLX_SVM_DPWM1) && (step % 60 == 0))
+                {
+                    // the clamped phase changes every 30 deg, either choice is valid there
+                    continue;
+                }
+                goldenDuties((PLX_SVM_Mode_t)mode, mags[m], theta, golden);
+                PLX_SVM_computeDuties((PLX_SVM_Mode_t)mode,
+                                      (float)(mags[m] * cos(theta)),
+                                      (float)(mags[m] * sin(theta)), duties);
+                for(k=0; k<3; k++)
+                {
+                    double err = fabs(duties[k] - golden[k]);
+                    maxErr = fmax(maxErr, err);
+                    CHECK(err < TOLERANCE,
+                          "mode %d, magnitude %g, angle %g deg, phase %d: %.9f, golden %.9f",
+                          mode, mags[m], step * 0.5, k, duties[k], golden[k]);
+                }
+
+                // all magnitudes are within the linear range of the injecting modes
+                if(mode != PLX_SVM_SINE)
+                {
+                    for(k=0; k<3; k++)
+                    {
+                        CHECK((duties[k] > -TOLERANCE) && (duties[k] < 1.0 + TOLERANCE),
+                              "mode %d, magnitude %g, angle %g deg: duty %f out of range",
+                              mode, mags[m], step * 0.5, duties[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    printf("max. deviation %.3g\n", maxErr);
+    return TEST_RESULT();
+}
@@ -0,0 +1,301 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+/*
+ * XCP server on a virtual CAN bus: the rx/tx callbacks of PLX_XCP_Params_t
+ * are served by per-mailbox frame queues, the test plays the XCP master.
+ *
+ * The server exchanges 32-bit addresses with the master, so the probed
+ * variables are placed in memory mapped below 4 GB. Addresses are byte
+ * addresses on the host, only single-transfer uploads are used since the
+ * MTA advances by words.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "plx_xcp.h"
+#include "test.h"
+
+#define CMD_MB 1
+#define RES_MB 2
+#define DTO_MB 3
+#define FRAME_LEN 64
+#define QUEUE_DEPTH 2
+
+// virtual CAN: one frame queue per mailbox
+typedef struct {
+    unsigned char data[QUEUE_DEPTH][FRAME_LEN];
+    unsigned char len[QUEUE_DEPTH];
+    uint16_t count;
+} Mailbox_t;
+
+static Mailbox_t Bus[8];
+
+static bool busPush(uint16_t aMailBox, const unsigned char *aData, unsigned char aLen)
+{
+    Mailbox_t *mb = &Bus[aMailBox];
+    if(mb->count == QUEUE_DEPTH)
+    {
+        return false; // mailbox busy
+    }
+    memcpy(mb->data[mb->count], aData, aLen);
+    mb->len[mb->count] = aLen;
+    mb->count++;
+    return true;
+}
+
+static bool busPop(uint16_t aMailBox, unsigned char *aData, unsigned char aLenMax)
+{
+    Mailbox_t *mb = &Bus[aMailBox];
+    if(mb->count == 0)
+    {
+        return false;
+    }
+    memcpy(aData, mb->data[0], (mb->len[0] < aLenMax) ? mb->len[0] : aLenMax);
+    memmove(mb->data[0], mb->data[1], sizeof(mb->data[0]) * (QUEUE_DEPTH - 1));
+    memmove(&mb->len[0], &mb->len[1], QUEUE_DEPTH - 1);
+    mb->count--;
+    return true;
+}
+
+static bool XcpRx(uint16_t aMailBox, unsigned char data[], unsigned char lenMax)
+{
+    return busPop(aMailBox, data, lenMax);
+}
+
+static bool XcpTx(uint16_t aMailBox, const unsigned char data[], unsigned char len)
+{
+    return busPush(aMailBox, data, len);
+}
+
+// probed model variables
+typedef struct {
+    uint16_t counter;
+    int32_t position;
+    float gain;
+    float offset;
+} Model_t;
+
+static PLX_XCP_Obj_t XcpObj;
+static PLX_XCP_Handle_t Xcp;
+static Model_t *Model;
+
+// master side: sends one command and returns the response length
+static int transact(const unsigned char *aCmd, int aLen, unsigned char *aRes)
+{
+    unsigned char frame[FRAME_LEN] = {0};
+    memcpy(frame, aCmd, aLen);
+    busPush(CMD_MB, frame, FRAME_LEN);
+    PLX_XCP_poll(Xcp);
+    return busPop(RES_MB, aRes, FRAME_LEN) ? FRAME_LEN : 0;
+}
+
+static void putU32(unsigned char *aBytes, uint32_t aVal)
+{
+    aBytes[0] = aVal & 0xFF;
+    aBytes[1] = (aVal >> 8) & 0xFF;
+    aBytes[2] = (aVal >> 16) & 0xFF;
+    aBytes[3] = (aVal >> 24) & 0xFF;
+}
+
+static uint32_t addr(void *aPtr)
+{
+    return (uint32_t)(uintptr_t)aPtr;
+}
+
+static void testConnect(void)
+{
+    unsigned char res[FRAME_LEN];
+    unsigned char status[] = {0xFD};
+    unsigned char connect[] = {0xFF, 0x00};
+
+    CHECK(transact(status, sizeof(status), res) == 0, "response before CONNECT");
+    CHECK(transact(connect, sizeof(connect), res) && (res[0] == 0xFF), "CONNECT");
+    CHECK((res[2] == 0x02) && (res[3] == FRAME_LEN), "CONNECT: comm mode 0x%02x, CTO %u", res[2], res[3]);
+    CHECK(transact(status, sizeof(status), res) && (res[0] == 0xFF) && (res[1] == 0), "GET_STATUS");
+}
+
+static void testProbes(void)
+{
+    unsigned char res[FRAME_LEN];
+    unsigned char num[] = {0xF1, 0x00};
+    unsigned char get[] = {0xF1, 0x01, 0x02, 0x00};
+    unsigned char bad[] = {0xF1, 0x01, 0x04, 0x00};
+
+    CHECK(transact(num, sizeof(num), res) && (res[0] == 0xFF) && (res[1] == 4), "number of probes");
+    CHECK(transact(get, sizeof(get), res) && (res[0] == 0xFF), "GET_PROBE");
+    CHECK((res[1] == 2) && (res[2] == (PLX_XCP_FLOAT | 0x80)), "probe 2: %u words, type 0x%02x", res[1], res[2]);
+    CHECK((res[4] | (res[5] << 8) | (res[6] << 16) | ((uint32_t)res[7] << 24)) == addr(&Model->gain),
+          "probe 2: address");
+    CHECK(transact(bad, sizeof(bad), res) && (res[0] == 0xFE) && (res[1] == 0x22), "probe index out of range");
+}
+
+static void testUpload(void)
+{
+    unsigned char res[FRAME_LEN];
+    unsigned char upload[8] = {0xF4, 2, 0, 0};
+
+    Model->position = -123456;
+    putU32(&upload[4], addr(&Model->position));
+    CHECK(transact(upload, sizeof(upload), res) && (res[0] == 0xFF), "SHORT_UPLOAD");
+    CHECK((int32_t)(res[2] | (res[3] << 8) | (res[4] << 16) | ((uint32_t)res[5] << 24)) == -123456,
+          "SHORT_UPLOAD data");
+}
+
+static void testCalibration(void)
+{
+    unsigned char res[FRAME_LEN];
+    unsigned char download[12] = {0xED, 2, 0, 0};
+    union { float f; uint32_t u; } val;
+
+    // in range, applied at the next quiet task boundary only
+    Model->gain = 1.0f;
+    val.f = 2.5f;
+    putU32(&download[4], addr(&Model->gain));
+    putU32(&download[8], val.u);
+    CHECK(transact(download, sizeof(download), res) && (res[0] == 0xFF), "SHORT_DOWNLOAD");
+    PLX_XCP_taskEnd(Xcp, 0, false);
+    CHECK(Model->gain == 1.0f, "calibration applied while a task was preempted");
+    CHECK(transact(download, sizeof(download), res) && (res[0] == 0xFE) && (res[1] == 0x10),
+          "second download while pending");
+    PLX_XCP_taskEnd(Xcp, 0, true);
+    CHECK(Model->gain == 2.5f, "calibration not applied: %f", Model->gain);
+
+    // out of range
+    val.f = 20.0f;
+    putU32(&download[8], val.u);
+    CHECK(transact(download, sizeof(download), res) && (res[0] == 0xFE) && (res[1] == 0x22),
+          "out-of-range calibration");
+
+    // read-only probe
+    putU32(&download[4], addr(&Model->position));
+    CHECK(transact(download, sizeof(download), res) && (res[0] == 0xFE) && (res[1] == 0x24),
+          "download to a read-only probe");
+    PLX_XCP_taskEnd(Xcp, 0, true);
+    CHECK(Model->gain == 2.5f, "rejected calibration was applied");
+}
+
+static void testDaq(void)
+{
+    unsigned char res[FRAME_LEN];
+    unsigned char dto[FRAME_LEN];
+    unsigned char freeDaq[] = {0xD6};
+    unsigned char allocDaq[] = {0xD5, 0, 1, 0};
+    unsigned char allocOdt[] = {0xD4, 0, 0, 0, 1};
+    unsigned char allocEntries[] = {0xD3, 0, 0, 0, 0, 2};
+    unsigned char setPtr[] = {0xE2, 0, 0, 0, 0, 0};
+    unsigned char writeDaq[8] = {0xE1, 0xFF, 1, 0};
+    unsigned char mode[] = {0xE0, 0x10, 0, 0, 1, 0, 2, 0};
+    unsigned char start[] = {0xDE, 1, 0, 0};
+    unsigned char stop[] = {0xDE, 0, 0, 0};
+    int n;
+
+    CHECK(transact(freeDaq, sizeof(freeDaq), res) && (res[0] == 0xFF), "FREE_DAQ");
+    CHECK(transact(allocDaq, sizeof(allocDaq), res) && (res[0] == 0xFF), "ALLOC_DAQ");
+    CHECK(transact(allocOdt, sizeof(allocOdt), res) && (res[0] == 0xFF), "ALLOC_ODT");
+    CHECK(transact(allocEntries, sizeof(allocEntries), res) && (res[0] == 0xFF), "ALLOC_ODT_ENTRY");
+    CHECK(transact(setPtr, sizeof(setPtr), res) && (res[0] == 0xFF), "SET_DAQ_PTR");
+    putU32(&writeDaq[4], addr(&Model->counter));
+    CHECK(transact(writeDaq, sizeof(writeDaq), res) && (res[0] == 0xFF), "WRITE_DAQ counter");
+    writeDaq[2] = 2;
+    putU32(&writeDaq[4], addr(&Model->position));
+    CHECK(transact(writeDaq, sizeof(writeDaq), res) && (res[0] == 0xFF), "WRITE_DAQ position");
+    // event 1, prescaler 2
+    CHECK(transact(mode, sizeof(mode), res) && (res[0] == 0xFF), "SET_DAQ_LIST_MODE");
+    CHECK(transact(start, sizeof(start), res) && (res[0] == 0xFF) && (res[1] == 0), "START_STOP_DAQ_LIST");
+
+    // sampled every second end of task 1 only
+    for(n=0; n<4; n++)
+    {
+        Model->counter = 100 + n;
+        Model->position = -n;
+        PLX_XCP_taskEnd(Xcp, 0, true);
+        PLX_XCP_taskEnd(Xcp, 1, true);
+        if(n & 1)
+        {
+            CHECK(busPop(DTO_MB, dto, FRAME_LEN), "no DTO after %d events", n + 1);
+            CHECK(dto[0] == 0, "PID %u", dto[0]);
+            CHECK((dto[1] | (dto[2] << 8)) == 100 + n, "DTO counter %u", dto[1] | (dto[2] << 8));
+            CHECK((int32_t)(dto[3] | (dto[4] << 8) | (dto[5] << 16) | ((uint32_t)dto[6] << 24)) == -n,
+                  "DTO position");
+        }
+        CHECK(Bus[DTO_MB].count == 0, "unexpected DTO after %d events", n + 1);
+    }
+
+    // a busy mailbox is counted as overrun
+    for(n=0; n<2*(QUEUE_DEPTH + 1); n++)
+    {
+        PLX_XCP_taskEnd(Xcp, 1, true);
+    }
+    CHECK(PLX_XCP_getDaqOverruns(Xcp) == 1, "%u overruns", (unsigned)PLX_XCP_getDaqOverruns(Xcp));
+    while(busPop(DTO_MB, dto, FRAME_LEN));
+
+    // configuration is locked while running
+    CHECK(transact(mode, sizeof(mode), res) && (res[0] == 0xFE) && (res[1] == 0x2A), "mode change while running");
+    CHECK(transact(stop, sizeof(stop), res) && (res[0] == 0xFF), "stop");
+    PLX_XCP_taskEnd(Xcp, 1, true);
+    PLX_XCP_taskEnd(Xcp, 1, true);
+    CHECK(Bus[DTO_MB].count == 0, "DTO after stop");
+}
+
+int main(void)
+{
+    PLX_XCP_Probe_t probes[4];
+    PLX_XCP_Params_t params;
+
+    Model = mmap(NULL, sizeof(Model_t), PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+    if(Model == MAP_FAILED)
+    {
+        printf("%s: no memory below 4 GB\n", __FILE__);
+        return 1;
+    }
+
+    probes[0] = (PLX_XCP_Probe_t){&Model->counter, PLX_XCP_UINT16, false, 0, 0};
+    probes[1] = (PLX_XCP_Probe_t){&Model->position, PLX_XCP_INT32, false, 0, 0};
+    probes[2] = (PLX_XCP_Probe_t){&Model->gain, PLX_XCP_FLOAT, true, 0.0f, 10.0f};
+    probes[3] = (PLX_XCP_Probe_t){&Model->offset, PLX_XCP_FLOAT, true, -1.0f, 1.0f};
+
+    memset(&params, 0, sizeof(params));
+    params.rx = XcpRx;
+    params.tx = XcpTx;
+    params.cmdMailbox = CMD_MB;
+    params.resMailbox = RES_MB;
+    params.dtoMailboxes[0] = DTO_MB;
+    params.numDaqLists = 1;
+    params.ctoLen = FRAME_LEN;
+    params.dtoLen = FRAME_LEN;
+    params.numEvents = 2;
+    params.probes = probes;
+    params.numProbes = 4;
+
+    PLX_XCP_sinit();
+    Xcp = PLX_XCP_init(&XcpObj, sizeof(XcpObj));
+    PLX_XCP_configure(Xcp, &params);
+
+    testConnect();
+    testProbes();
+    testUpload();
+    testCalibration();
+    testDaq();
+
+    return TEST_RESULT();
+}
@@ -43,4 +43,25 @@ extern uint16_t PLX_AIN_getIn(PLX_AIN_Handle_t aHandle, uint16_t aChannel);
 
 extern float PLX_AIN_getInF(PLX_AIN_Handle_t aHandle, uint16_t aChannel);
 
+extern void PLX_AIN_getFrameF(PLX_AIN_Handle_t aHandle, float *aOut, uint16_t aMask);
+
+extern float PLX_AIN_getInOversampledF(PLX_AIN_Handle_t aHandle, uint16_t aChannel);
+
+// DMA ring buffer capture, only available on devices with DMA access to the ADC results
+extern void PLX_AIN_setupCapture(PLX_AIN_Handle_t aHandle, uint16_t aDmaChannel, uint16_t *aBuffer, uint16_t aNumFrames, uint16_t aFrameSize, uint16_t aPostTrigger);
+
+extern void PLX_AIN_armCapture(PLX_AIN_Handle_t aHandle);
+
+extern void PLX_AIN_triggerCapture(PLX_AIN_Handle_t aHandle);
+
+extern void PLX_AIN_pollCapture(PLX_AIN_Handle_t aHandle);
+
+extern uint16_t PLX_AIN_getCaptureState(PLX_AIN_Handle_t aHandle);
+
+extern uint16_t PLX_AIN_getCaptureFrame(PLX_AIN_Handle_t aHandle);
+
+extern uint16_t PLX_AIN_getCaptureStartFrame(PLX_AIN_Handle_t aHandle);
+
+extern uint16_t PLX_AIN_getCaptureTriggerFrame(PLX_AIN_Handle_t aHandle);
+
 #endif /* PLX_AIN_H_ */
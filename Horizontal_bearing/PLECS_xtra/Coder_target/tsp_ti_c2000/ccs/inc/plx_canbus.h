@@ -51,6 +51,9 @@ extern bool PLX_CANBUS_getMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox
 
 extern bool PLX_CANBUS_putMessage(PLX_CANBUS_Handle_t aHandle, uint16_t aMailBox, const unsigned char data[], unsigned char len);
 
+// interrupt mode only (DCAN): copies received frames into RAM, call from the CAN interrupt 0 ISR
+extern void PLX_CANBUS_isr(PLX_CANBUS_Handle_t aHandle);
+
 // deprecated
 extern void PLX_CANBUS_configureViaPinSet(PLX_CANBUS_Handle_t aHandle, PLX_CANBUS_Unit_t aUnit, uint16_t aPinset, const PLX_CANBUS_Params_t *aParams);
 
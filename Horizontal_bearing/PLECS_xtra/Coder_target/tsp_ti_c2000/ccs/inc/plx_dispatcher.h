@@ -26,6 +26,7 @@
 typedef void(*DISPR_TaskPtr_t)(bool, void * const);
 typedef void(*DISPR_IdleTaskPtr_t)();
 typedef void(*DISPR_SyncCallbackPtr_t)();
+typedef void(*DISPR_TaskEndCallbackPtr_t)(uint16_t aTaskId, bool aTasksIdle);
 
 #include "plx_dispatcher_impl.h"
 
@@ -36,6 +37,8 @@ extern void DISPR_setPowerupDelay(uint16_t aDelayInBaseTaskTicks);
 extern void DISPR_registerTask(uint16_t aTaskId, DISPR_TaskPtr_t aTsk, uint32_t aPeriodInTimerTicks, void * const aParameters);
 extern void DISPR_registerIdleTask(DISPR_IdleTaskPtr_t aTsk);
 extern void DISPR_registerSyncCallback(DISPR_SyncCallbackPtr_t aCallback);
+// called with interrupts disabled after each task step, aTasksIdle is true if no other task is preempted
+extern void DISPR_registerTaskEndCallback(DISPR_TaskEndCallbackPtr_t aCallback);
 
 extern void DISPR_start();
 extern void DISPR_dispatch();
@@ -0,0 +1,43 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+#ifndef PLX_DMA_H_
+#define PLX_DMA_H_
+
+#include "plx_dma_impl.h" // implementation specific
+
+extern void PLX_DMA_sinit();
+
+extern PLX_DMA_Handle_t PLX_DMA_init(void *aMemory, const size_t aNumBytes);
+
+extern void PLX_DMA_setDefaultParams(PLX_DMA_Params_t *aParams);
+
+extern void PLX_DMA_configure(PLX_DMA_Handle_t aHandle, uint16_t aChannel, const PLX_DMA_Params_t *aParams);
+
+extern void PLX_DMA_start(PLX_DMA_Handle_t aHandle);
+
+extern void PLX_DMA_stop(PLX_DMA_Handle_t aHandle);
+
+extern bool PLX_DMA_isRunning(PLX_DMA_Handle_t aHandle);
+
+extern uint16_t PLX_DMA_getDstOffset(PLX_DMA_Handle_t aHandle);
+
+#endif /* PLX_DMA_H_ */
@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+#ifndef PLX_FSI_H_
+#define PLX_FSI_H_
+
+#include "plx_fsi_impl.h" // implementation specific
+
+/* Fast serial interface, one handle per transmitter or receiver port.
+ *
+ * Data is exchanged in N-word frames of PLX_FSI_Params_t.numWords. The
+ * transmitter places a rolling sequence number into the user data field,
+ * which allows the receiver to count lost frames. Optional ping frames keep
+ * the link alive while no data is sent; the receiver flags a link loss when
+ * neither data nor ping frames arrive within the ping timeout.
+ */
+extern PLX_FSI_Handle_t PLX_FSI_init(void *aMemory, const size_t aNumBytes);
+
+extern void PLX_FSI_setDefaultParams(PLX_FSI_Params_t *aParams);
+
+extern void PLX_FSI_configure(PLX_FSI_Handle_t aHandle, PLX_FSI_Port_t aPort, const PLX_FSI_Params_t *aParams);
+
+// transmitter: returns false if the previous frame has not been sent yet
+extern bool PLX_FSI_putFrame(PLX_FSI_Handle_t aHandle, const uint16_t *aData);
+
+// receiver: returns true if a frame was received since the last call, aData is set to the latest frame
+extern bool PLX_FSI_getFrame(PLX_FSI_Handle_t aHandle, uint16_t *aData);
+
+// collects and clears the event flags, to be called periodically
+extern void PLX_FSI_updateStatus(PLX_FSI_Handle_t aHandle);
+
+extern bool PLX_FSI_isLinkUp(PLX_FSI_Handle_t aHandle);
+
+extern uint32_t PLX_FSI_getFrameCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getLostFrameCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getPingCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getPingTimeoutCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getCrcErrorCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getFrameErrorCount(PLX_FSI_Handle_t aHandle);
+extern uint32_t PLX_FSI_getOverrunCount(PLX_FSI_Handle_t aHandle);
+
+/* DMA receive frames, only available on devices with DMA access to the FSI:
+ * Each received data frame is copied to alternating banks of aRxFrames
+ * (2*numWords words) without CPU involvement. The DMA follows the circular
+ * receive buffer, which requires numWords to be a power of two. The buffer
+ * pointers are realigned when PLX_FSI_updateStatus() detects a corrupted
+ * frame.
+ */
+extern void PLX_FSI_setupDmaRxFrames(PLX_FSI_Handle_t aHandle, uint16_t aDmaChannel, uint16_t *aRxFrames);
+
+// returns true if a frame was received since the last call, aFrame is set to the latest complete frame
+extern bool PLX_FSI_getDmaRxFrame(PLX_FSI_Handle_t aHandle, uint16_t **aFrame);
+
+#endif /* PLX_FSI_H_ */
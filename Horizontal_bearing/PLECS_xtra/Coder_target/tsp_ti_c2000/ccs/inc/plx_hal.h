@@ -25,7 +25,12 @@ extern bool PLXHAL_DIO_get(uint16_t aHandle);
 extern void PLXHAL_DIO_set(uint16_t aHandle, bool aVal);
 
 extern void PLXHAL_PWM_setDutyFreqPhase(uint16_t aChannel, float aDuty, float aFreqScaling, float aPhase);
+extern void PLXHAL_PWM_commitGlobalLoad(uint16_t aChannel);
 extern void PLXHAL_PWM_setDuty(uint16_t aHandle, float aDuty);
+extern void PLXHAL_PWM_setDutyN(uint16_t aFirstHandle, const float *aDuties, uint16_t aNum);
+extern void PLXHAL_PWM_setClaDutyN(uint16_t aGroup, uint16_t aFirstSlot, const float *aDuties, uint16_t aNum);
+extern void PLXHAL_PWM_setSvm(uint16_t aFirstHandle, uint16_t aMode, float aAlpha, float aBeta);
+extern void PLXHAL_PWM_setMultiLevelRefN(uint16_t aFirstHandle, const float *aRefs, uint16_t aNumPhases, uint16_t aModulesPerPhase);
 extern void PLXHAL_PWM_setToPassive(uint16_t aChannel);
 extern void PLXHAL_PWM_setToOperational(uint16_t aChannel);
 extern void PLXHAL_PWM_setSequence(uint16_t aChannel, uint16_t aSequence);
@@ -39,6 +44,17 @@ extern void PLXHAL_PWR_syncdPwmEnable();
 extern bool PLXHAL_PWR_isEnabled();
 
 extern float PLXHAL_ADC_getIn(uint16_t aHandle, uint16_t aChannel);
+extern float PLXHAL_ADC_getInOversampled(uint16_t aHandle, uint16_t aChannel);
+extern void PLXHAL_ADC_getFrame(uint16_t aHandle, float *aOut, uint16_t aMask);
+extern void PLXHAL_ADC_armCapture(uint16_t aHandle);
+extern void PLXHAL_ADC_triggerCapture(uint16_t aHandle);
+extern void PLXHAL_ADC_pollCapture(uint16_t aHandle);
+extern uint16_t PLXHAL_ADC_getCaptureState(uint16_t aHandle);
+extern uint16_t PLXHAL_ADC_getCaptureStartFrame(uint16_t aHandle);
+extern uint16_t PLXHAL_ADC_getCaptureTriggerFrame(uint16_t aHandle);
+
+extern float PLXHAL_SDFM_getIn(uint16_t aHandle, uint16_t aChannel);
+extern void PLXHAL_SDFM_getFrame(uint16_t aHandle, float *aOut, uint16_t aMask);
 
 extern void PLXHAL_DAC_set(uint16_t aHandle, float aValue);
 
@@ -79,11 +95,32 @@ extern void PLXHAL_MCAN_putMessage(uint16_t aChannel, uint16_t aMailBox, unsigne
 extern void PLXHAL_MCAN_setBusOn(uint16_t aChannel, bool aBusOn);
 extern bool PLXHAL_MCAN_getIsBusOn(uint16_t aChannel);
 extern bool PLXHAL_MCAN_getIsErrorActive(uint16_t aChannel);
+extern void PLXHAL_MCAN_poll(uint16_t aChannel);
+extern void PLXHAL_MCAN_flushTx(uint16_t aChannel);
+extern uint32_t PLXHAL_MCAN_getTxDropCount(uint16_t aChannel, uint16_t aMailBox);
 
 uint16_t PLXHAL_SPI_getRxFifoLevel(int16_t aChannel);
 bool PLXHAL_SPI_putWords(int16_t aChannel, uint16_t *aData, uint16_t aLen);
 bool PLXHAL_SPI_getWords(int16_t aChannel, uint16_t *aData, uint16_t aLen);
 bool PLXHAL_SPI_getAndResetRxOverrunFlag(int16_t aChannel);
+uint16_t *PLXHAL_SPI_getDmaTxFrame(int16_t aChannel);
+bool PLXHAL_SPI_getDmaRxFrame(int16_t aChannel, uint16_t **aFrame);
+bool PLXHAL_SPI_getDmaSlaveRxFrame(int16_t aChannel, uint16_t **aFrame);
+uint32_t PLXHAL_SPI_getDmaFrameCount(int16_t aChannel);
+uint32_t PLXHAL_SPI_getDmaFramingErrorCount(int16_t aChannel);
+bool PLXHAL_SPI_startTransactions(int16_t aChannel, uint16_t *aTxData, uint16_t *aRxData);
+bool PLXHAL_SPI_transactionsBusy(int16_t aChannel);
+
+bool PLXHAL_FSI_putFrame(int16_t aChannel, const uint16_t *aData);
+bool PLXHAL_FSI_getFrame(int16_t aChannel, uint16_t *aData);
+bool PLXHAL_FSI_getDmaRxFrame(int16_t aChannel, uint16_t **aFrame);
+void PLXHAL_FSI_updateStatus(int16_t aChannel);
+bool PLXHAL_FSI_isLinkUp(int16_t aChannel);
+uint32_t PLXHAL_FSI_getErrorCount(int16_t aChannel);
+
+bool PLXHAL_I2C_request(uint16_t aTransaction);
+bool PLXHAL_I2C_getRxData(uint16_t aTransaction, uint16_t *aData);
+uint32_t PLXHAL_I2C_getErrorCount(uint16_t aChannel);
 
 extern float PLXHAL_DISPR_getTask0LoadInPercent();
 
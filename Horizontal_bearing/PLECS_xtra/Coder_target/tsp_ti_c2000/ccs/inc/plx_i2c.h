@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+#ifndef PLX_I2C_H_
+#define PLX_I2C_H_
+
+#include "plx_i2c_impl.h" // implementation specific
+
+/* I2C master with a queue of transactions, one handle per I2C module.
+ *
+ * Transactions are owned by the caller and must not be modified while
+ * pending. PLX_I2C_queueTransaction() never waits for the bus: queued
+ * transactions are processed by PLX_I2C_isr(), one at a time, with both
+ * phases passing through the FIFOs. PLX_I2C_poll() is meant to be called from
+ * the background loop, it starts transactions that were deferred because the
+ * bus was busy and resets the module if the bus makes no progress within the
+ * configured timeout (e.g. a slave stretching the clock indefinitely).
+ */
+extern PLX_I2C_Handle_t PLX_I2C_init(void *aMemory, const size_t aNumBytes);
+
+extern void PLX_I2C_setDefaultParams(PLX_I2C_Params_t *aParams);
+
+extern void PLX_I2C_configure(PLX_I2C_Handle_t aHandle, PLX_I2C_Unit_t aUnit, uint32_t aSysClkHz, const PLX_I2C_Params_t *aParams);
+
+extern void PLX_I2C_setupTransaction(PLX_I2C_Transaction_t *aTransaction, uint16_t aAddress, const uint16_t *aTxData, uint16_t aTxLen, uint16_t *aRxData, uint16_t aRxLen);
+
+// returns false if the transaction is still pending or the queue is full
+extern bool PLX_I2C_queueTransaction(PLX_I2C_Handle_t aHandle, PLX_I2C_Transaction_t *aTransaction);
+
+// copies the received bytes once after successful completion
+extern bool PLX_I2C_getRxData(PLX_I2C_Transaction_t *aTransaction, uint16_t *aData);
+
+extern void PLX_I2C_isr(PLX_I2C_Handle_t aHandle);
+
+extern void PLX_I2C_poll(PLX_I2C_Handle_t aHandle);
+
+extern bool PLX_I2C_isBusy(PLX_I2C_Handle_t aHandle);
+
+extern bool PLX_I2C_isPending(const PLX_I2C_Transaction_t *aTransaction);
+
+extern PLX_I2C_Status_t PLX_I2C_getStatus(const PLX_I2C_Transaction_t *aTransaction);
+
+extern uint32_t PLX_I2C_getNackCount(PLX_I2C_Handle_t aHandle);
+
+extern uint32_t PLX_I2C_getArbitrationLostCount(PLX_I2C_Handle_t aHandle);
+
+extern uint32_t PLX_I2C_getTimeoutCount(PLX_I2C_Handle_t aHandle);
+
+#endif /* PLX_I2C_H_ */
@@ -54,5 +54,14 @@ extern bool PLX_MCAN_getMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, un
 
 extern bool PLX_MCAN_putMessage(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox, const unsigned char data[], unsigned char len);
 
+// queue mode only: submits staged messages with a single add request, call once per tick
+extern void PLX_MCAN_flushTx(PLX_MCAN_Handle_t aHandle);
+
+// number of messages of a tx mailbox which were discarded (bus-off or overwritten while pending)
+extern uint32_t PLX_MCAN_getTxDropCount(PLX_MCAN_Handle_t aHandle, uint16_t aMailBox);
+
+// FIFO mode only: drains the RX FIFO into the mailboxes and samples the bus state, call once per tick
+extern void PLX_MCAN_poll(PLX_MCAN_Handle_t aHandle);
+
 
 #endif /* PLX_MCAN_H_ */
@@ -63,10 +63,24 @@ extern bool PLX_PWM_pwmOutputIsEnabled(PLX_PWM_Handle_t aHandle);
 
 extern void PLX_PWM_disableOut(PLX_PWM_Handle_t aHandle);
 
+extern void PLX_PWM_initGroup(PLX_PWM_Group_t *aGroup);
+
+extern void PLX_PWM_addToGroup(PLX_PWM_Group_t *aGroup, PLX_PWM_Handle_t aHandle);
+
+extern void PLX_PWM_enableGroupOut(const PLX_PWM_Group_t *aGroup);
+
+extern void PLX_PWM_disableGroupOut(const PLX_PWM_Group_t *aGroup);
+
 extern void PLX_PWM_setDeadTimeCounts(PLX_PWM_Handle_t aHandle, uint16_t aRisingEdgeDelay, uint16_t aFallingEdgeDelay);
 
 extern void PLX_PWM_setPwmDuty(PLX_PWM_Handle_t aHandle, float aDuty);
 
+extern void PLX_PWM_setDutyN(const PLX_PWM_Handle_t *aHandles, const float *aDuties, uint16_t aNum);
+
+extern void PLX_PWM_getDutyScaling(PLX_PWM_Handle_t aHandle, float *aOffset, float *aScale);
+
+extern void PLX_PWM_updateDutyScaling(PLX_PWM_Handle_t aHandle);
+
 extern void PLX_PWM_enableAllClocks();
 
 extern void PLX_PWM_disableAllClocks();
@@ -38,6 +38,31 @@ extern void PLX_SCI_putChar(PLX_SCI_Handle_t aHandle, uint16_t c);
 extern bool PLX_SCI_breakOccurred(PLX_SCI_Handle_t aHandle);
 extern void PLX_SCI_reset(PLX_SCI_Handle_t aHandle);
 
+/*
+ * Buffered operation (driverlib targets).
+ *
+ * PLX_SCI_setupBuffers() must be called before PLX_SCI_setupPort(). The
+ * RX/TX FIFO interrupts then move characters between the FIFOs and the
+ * RAM rings; PLX_SCI_rxIsr()/PLX_SCI_txIsr() are to be attached to the
+ * SCI PIE vectors. Ring lengths must be powers of two.
+ *
+ * PLX_SCI_read() and PLX_SCI_write() do not block and return the number
+ * of characters transferred. Each must only be called from one context.
+ * The character API above is for non-buffered operation only.
+ */
+extern void PLX_SCI_setupBuffers(PLX_SCI_Handle_t aHandle, uint16_t *aRxBuf, uint16_t aRxLen, uint16_t *aTxBuf, uint16_t aTxLen);
+
+extern uint16_t PLX_SCI_read(PLX_SCI_Handle_t aHandle, uint16_t *aData, uint16_t aMaxLen);
+extern uint16_t PLX_SCI_write(PLX_SCI_Handle_t aHandle, const uint16_t *aData, uint16_t aLen);
+
+extern void PLX_SCI_rxIsr(PLX_SCI_Handle_t aHandle);
+extern void PLX_SCI_txIsr(PLX_SCI_Handle_t aHandle);
+
+// characters lost to FIFO overflow or a full RX ring
+extern uint32_t PLX_SCI_getRxOverrunCount(PLX_SCI_Handle_t aHandle);
+extern uint32_t PLX_SCI_getFramingErrorCount(PLX_SCI_Handle_t aHandle);
+extern uint32_t PLX_SCI_getBreakCount(PLX_SCI_Handle_t aHandle);
+
 // deprecated
 extern void PLX_SCI_configureViaPinSet(PLX_SCI_Handle_t aHandle, uint16_t port, uint32_t clk);
 
@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2022 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+#ifndef PLX_SDFM_H_
+#define PLX_SDFM_H_
+
+#include "plx_sdfm_impl.h" // implementation specific
+
+/* Sigma-delta filter module, one handle per SDFM unit (4 filter channels).
+ *
+ * Filter results are read as 16-bit values, the shift is chosen such that
+ * the full scale of the selected sinc filter and OSR fits. Scale and offset
+ * are applied to the result normalized to full scale (-1..1).
+ */
+extern PLX_SDFM_Handle_t PLX_SDFM_init(void *aMemory, const size_t aNumBytes);
+
+extern void PLX_SDFM_configure(PLX_SDFM_Handle_t aHandle, PLX_SDFM_Unit_t aUnit);
+
+extern void PLX_SDFM_setDefaultChannelParams(PLX_SDFM_ChannelParams_t *aParams);
+
+extern void PLX_SDFM_setupChannel(PLX_SDFM_Handle_t aHandle, uint16_t aChannel, const PLX_SDFM_ChannelParams_t *aParams);
+
+// enables the data filters of all channels set up so far
+extern void PLX_SDFM_enable(PLX_SDFM_Handle_t aHandle);
+
+extern float PLX_SDFM_getInF(PLX_SDFM_Handle_t aHandle, uint16_t aChannel);
+
+extern void PLX_SDFM_getFrameF(PLX_SDFM_Handle_t aHandle, float *aOut, uint16_t aMask);
+
+/* DMA transfer of filter results, only available on devices with DMA access
+ * to the SDFM: The results of all channels are copied to aResults
+ * (PLX_SDFM_NUM_CHANNELS words) whenever aTriggerChannel has new data, the
+ * readout functions above then read from aResults instead of the registers.
+ * Channels read together should use the same filter type and OSR.
+ */
+extern void PLX_SDFM_setupDma(PLX_SDFM_Handle_t aHandle, uint16_t aDmaChannel, uint16_t aTriggerChannel, int16_t *aResults);
+
+#endif /* PLX_SDFM_H_ */
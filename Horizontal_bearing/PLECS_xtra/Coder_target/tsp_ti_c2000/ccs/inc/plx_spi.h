@@ -39,6 +39,53 @@ extern bool PLX_SPI_getWords(PLX_SPI_Handle_t aHandle, uint16_t *aData, uint16_t
 
 extern void PLX_SPI_putGetWords(PLX_SPI_Handle_t aHandle, uint16_t *aOutData, uint16_t *aInData, uint16_t aLen);
 
+/* DMA frame engine, only available on devices with DMA access to the SPI:
+ * Each trigger sends aFrameSize words from aTxFrame. The received words are
+ * written alternately to the two banks of aRxFrames (2*aFrameSize words).
+ * The words bypass the shift and mask of PLX_SPI_putWords()/PLX_SPI_getWords(),
+ * i.e. TX words must be left-justified for word lengths below 16 bits.
+ */
+extern void PLX_SPI_setupDmaFrames(PLX_SPI_Handle_t aHandle, uint16_t aTxDmaChannel, uint16_t aRxDmaChannel, uint16_t aTrigger, uint16_t *aTxFrame, uint16_t *aRxFrames, uint16_t aFrameSize);
+
+extern void PLX_SPI_startDmaFrames(PLX_SPI_Handle_t aHandle);
+
+// frame sent with the next trigger, can be updated in place
+extern uint16_t *PLX_SPI_getDmaTxFrame(PLX_SPI_Handle_t aHandle);
+
+// returns true if a frame was completed since the last call, aFrame is set to the latest complete frame
+extern bool PLX_SPI_getDmaRxFrame(PLX_SPI_Handle_t aHandle, uint16_t **aFrame);
+
+/* DMA slave frames:
+ * The TX FIFO is refilled with aTxFrame as soon as the master has clocked
+ * out the previous frame. Each received frame ends an RX DMA transfer;
+ * PLX_SPI_dmaSlaveRxIsr() must be attached to the RX DMA channel interrupt
+ * and alternates the banks of aRxFrames. Words left in the RX FIFO while
+ * /CS (aSteGpio) is released count as framing error, the frame is dropped
+ * and the FIFOs are resynchronized. Started with PLX_SPI_startDmaFrames().
+ */
+extern void PLX_SPI_setupDmaSlaveFrames(PLX_SPI_Handle_t aHandle, uint16_t aTxDmaChannel, uint16_t aRxDmaChannel, uint16_t aSteGpio, uint16_t *aTxFrame, uint16_t *aRxFrames, uint16_t aFrameSize);
+
+extern void PLX_SPI_dmaSlaveRxIsr(PLX_SPI_Handle_t aHandle);
+
+// returns true if a frame was received since the last call, aFrame is set to the latest valid frame
+extern bool PLX_SPI_getDmaSlaveRxFrame(PLX_SPI_Handle_t aHandle, uint16_t **aFrame);
+
+extern uint32_t PLX_SPI_getDmaFrameCount(PLX_SPI_Handle_t aHandle);
+extern uint32_t PLX_SPI_getDmaFramingErrorCount(PLX_SPI_Handle_t aHandle);
+
+/* Transaction sequence, driven by the RX FIFO interrupt:
+ * PLX_SPI_startTransactions() services the slaves of aTable back to back,
+ * asserting each chip select for len words. The words of all slaves are
+ * concatenated in aTxData/aRxData, which must remain valid until
+ * PLX_SPI_transactionsBusy() returns false. PLX_SPI_transactionIsr() is
+ * to be attached to the SPI RX PIE vector. A start request is rejected
+ * (returns false) while the previous sequence is still running.
+ */
+extern void PLX_SPI_setupTransactions(PLX_SPI_Handle_t aHandle, const PLX_SPI_Transaction_t *aTable, uint16_t aNumTransactions);
+extern bool PLX_SPI_startTransactions(PLX_SPI_Handle_t aHandle, uint16_t *aTxData, uint16_t *aRxData);
+extern bool PLX_SPI_transactionsBusy(PLX_SPI_Handle_t aHandle);
+extern void PLX_SPI_transactionIsr(PLX_SPI_Handle_t aHandle);
+
 // deprecated
 extern void PLX_SPI_setupPortViaPinSet(PLX_SPI_Handle_t aHandle, uint16_t aPinSet, PLX_SPI_Params_t *aParams);
 
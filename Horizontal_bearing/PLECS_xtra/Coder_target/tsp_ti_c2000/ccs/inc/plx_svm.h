@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2014-2020 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+#include "plx_pwm.h"
+
+#ifndef PLX_SVM_H_
+#define PLX_SVM_H_
+
+/*
+ * Three-leg modulator kernels.
+ *
+ * The alpha/beta references are normalized to half the DC link voltage,
+ * i.e. a phase reference of +/-1 corresponds to a duty of 1.0/0.0. The
+ * linear range extends to a magnitude of 2/sqrt(3) for all modes except
+ * PLX_SVM_SINE.
+ */
+typedef enum PLX_SVM_MODE {
+    PLX_SVM_SINE = 0,    // no zero-sequence injection
+    PLX_SVM_THI,         // 1/6 third-harmonic injection
+    PLX_SVM_SVPWM,       // min/max (symmetrical) space-vector
+    PLX_SVM_DPWM1,       // 60 deg clamp around the phase peaks
+    PLX_SVM_DPWMMAX,     // 120 deg clamp to the positive rail
+    PLX_SVM_DPWMMIN      // 120 deg clamp to the negative rail
+} PLX_SVM_Mode_t;
+
+extern void PLX_SVM_computeDuties(PLX_SVM_Mode_t aMode, float aAlpha, float aBeta, float *aDuties);
+
+extern void PLX_SVM_setDuties(const PLX_PWM_Handle_t *aHandles, PLX_SVM_Mode_t aMode, float aAlpha, float aBeta);
+
+/*
+ * Multi-level (phase-disposition) leg modulation.
+ *
+ * Each phase is driven by aModulesPerPhase consecutive PWM modules, the
+ * module with the lowest carrier band first (e.g. NPC: lower, upper). The
+ * phase reference spans -1..1 over all bands; the module owning the band
+ * modulates, modules below it are saturated at 1, those above at 0.
+ * This moves the band mapping out of the model; every module is still
+ * written on each call.
+ */
+#define PLX_SVM_MAX_LEVEL_MODULES 4
+
+extern void PLX_SVM_setMultiLevelDutyN(const PLX_PWM_Handle_t *aHandles, const float *aRefs, uint16_t aNumPhases, uint16_t aModulesPerPhase);
+
+#endif /* PLX_SVM_H_ */
@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2014-2021 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "includes.h"
+
+#ifndef PLX_XCP_H_
+#define PLX_XCP_H_
+
+/*
+ * Measurement and calibration server (subset of XCP on CAN).
+ *
+ * Address granularity is WORD (16-bit), byte order Intel. Each DAQ list
+ * consists of a single ODT which is packed into one DTO frame, its PID is
+ * the DAQ list number. Events are the dispatcher tasks (0 = base task).
+ * Downloads are only accepted for registered calibrations and are applied
+ * from PLX_XCP_taskEnd() once no task is preempted.
+ */
+typedef bool(*PLX_XCP_RxPtr_t)(uint16_t aMailBox, unsigned char data[], unsigned char lenMax);
+typedef bool(*PLX_XCP_TxPtr_t)(uint16_t aMailBox, const unsigned char data[], unsigned char len);
+
+typedef enum PLX_XCP_PROBE_TYPE {
+    PLX_XCP_UINT16 = 0,
+    PLX_XCP_INT16,
+    PLX_XCP_UINT32,
+    PLX_XCP_INT32,
+    PLX_XCP_FLOAT
+} PLX_XCP_ProbeType_t;
+
+typedef struct PLX_XCP_PROBE {
+    void *addr;
+    PLX_XCP_ProbeType_t type;
+    bool writable; // calibration
+    float min;
+    float max;
+} PLX_XCP_Probe_t;
+
+#include "plx_xcp_impl.h"
+
+extern void PLX_XCP_sinit();
+
+extern PLX_XCP_Handle_t PLX_XCP_init(void *aMemory, const size_t aNumBytes);
+
+extern void PLX_XCP_configure(PLX_XCP_Handle_t aHandle, const PLX_XCP_Params_t *aParams);
+
+// processes one pending command, call from background
+extern void PLX_XCP_poll(PLX_XCP_Handle_t aHandle);
+
+// samples the DAQ lists of event aTaskId, register with DISPR_registerTaskEndCallback()
+extern void PLX_XCP_taskEnd(PLX_XCP_Handle_t aHandle, uint16_t aTaskId, bool aTasksIdle);
+
+extern uint32_t PLX_XCP_getDaqOverruns(PLX_XCP_Handle_t aHandle);
+
+#endif /* PLX_XCP_H_ */
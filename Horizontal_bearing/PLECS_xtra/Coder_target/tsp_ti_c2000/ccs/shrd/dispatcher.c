@@ -36,6 +36,7 @@ void DISPR_sinit()
     obj->numTasks = 0;
     obj->idleTask = (DISPR_IdleTaskPtr_t)0;
     obj->syncCallback = (DISPR_SyncCallbackPtr_t)0;
+    obj->taskEndCallback = (DISPR_TaskEndCallbackPtr_t)0;
 }
 
 void DISPR_configure(uint32_t aBasePeriodInTimerTicks, PIL_Handle_t aPilHandle,
@@ -71,6 +72,12 @@ void DISPR_registerSyncCallback(DISPR_SyncCallbackPtr_t aCallback)
     obj->syncCallback = aCallback;
 }
 
+void DISPR_registerTaskEndCallback(DISPR_TaskEndCallbackPtr_t aCallback)
+{
+    DISPR_Obj_t *obj = (DISPR_Obj_t *)DisprHandle;
+    obj->taskEndCallback = aCallback;
+}
+
 void DISPR_registerIdleTask(DISPR_IdleTaskPtr_t aTsk)
 {
     DISPR_Obj_t *obj = (DISPR_Obj_t *)DisprHandle;
@@ -190,6 +197,9 @@ void DISPR_dispatch(){
                 if(obj->pilHandle != 0){
                     PIL_SCOPE_sample(obj->pilHandle);
                 }
+                if(obj->taskEndCallback){
+                    obj->taskEndCallback(0, (obj->tasksRunningFlags == 0));
+                }
                 obj->timeStamp2Last = CpuTimer1Regs.TIM.all; // end of task
             }
             else
@@ -219,6 +229,9 @@ void DISPR_dispatch(){
             obj->tskMemory[i].tsk(false, obj->tskMemory[i].params);
             DINT;
             obj->tasksRunningFlags &= (~obj->tskMemory[i].mask);
+            if(obj->taskEndCallback){
+                obj->taskEndCallback(i, (obj->tasksRunningFlags == 0));
+            }
         }
         ready >>= 1;
         i++;
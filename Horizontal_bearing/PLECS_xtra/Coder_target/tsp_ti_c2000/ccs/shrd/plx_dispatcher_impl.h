@@ -40,6 +40,7 @@ typedef struct DISPR_OBJ
     uint16_t tasksRunningFlags;
     DISPR_IdleTaskPtr_t idleTask;
     DISPR_SyncCallbackPtr_t syncCallback;
+    DISPR_TaskEndCallbackPtr_t taskEndCallback;
     uint16_t powerupDelayIntTask1Ticks;
     uint16_t powerupCountdown;
 
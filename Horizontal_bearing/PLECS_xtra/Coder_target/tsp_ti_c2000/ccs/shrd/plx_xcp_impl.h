@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2014-2021 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#ifndef PLX_XCP_IMPL_H_
+#define PLX_XCP_IMPL_H_
+
+#define PLX_XCP_MAX_DAQ_LISTS 4
+#define PLX_XCP_MAX_ODT_ENTRIES 31 // 62 bytes of an FD frame
+#define PLX_XCP_MAX_FRAME_LEN 64
+
+typedef struct PLX_XCP_ODT_ENTRY {
+    uint32_t addr;
+    uint16_t size; // in words
+} PLX_XCP_OdtEntry_t;
+
+typedef struct PLX_XCP_DAQ_LIST {
+    PLX_XCP_OdtEntry_t entries[PLX_XCP_MAX_ODT_ENTRIES];
+    uint16_t numEntries;
+    uint16_t numOdts;
+    uint16_t event;
+    uint16_t prescaler;
+    uint16_t counter;
+    bool selected;
+    bool running;
+} PLX_XCP_DaqList_t;
+
+typedef struct PLX_XCP_PARAMS {
+    PLX_XCP_RxPtr_t rx;
+    PLX_XCP_TxPtr_t tx;
+    uint16_t cmdMailbox;
+    uint16_t resMailbox;
+    uint16_t dtoMailboxes[PLX_XCP_MAX_DAQ_LISTS];
+    uint16_t numDaqLists;
+    unsigned char ctoLen;
+    unsigned char dtoLen;
+    uint16_t numEvents;
+    const PLX_XCP_Probe_t *probes;
+    uint16_t numProbes;
+} PLX_XCP_Params_t;
+
+typedef struct PLX_XCP_OBJ
+{
+    PLX_XCP_Params_t par;
+
+    bool connected;
+    uint32_t mta;
+
+    PLX_XCP_DaqList_t daq[PLX_XCP_MAX_DAQ_LISTS];
+    uint16_t numDaqLists;
+    uint16_t daqPtrList;
+    uint16_t daqPtrEntry;
+    uint32_t daqOverruns;
+
+    // staged calibration write
+    volatile bool calPending;
+    uint16_t calWords;
+    uint16_t *calAddr;
+    uint16_t calData[2];
+
+    unsigned char cmd[PLX_XCP_MAX_FRAME_LEN];
+    unsigned char res[PLX_XCP_MAX_FRAME_LEN];
+} PLX_XCP_Obj_t;
+
+typedef PLX_XCP_Obj_t *PLX_XCP_Handle_t;
+
+#endif /* PLX_XCP_IMPL_H_ */
@@ -46,6 +46,7 @@ void PLX_PWR_configure(PLX_DIO_Handle_t aGateDrvEnableHandle, uint16_t aFsmExecR
     obj->enableDelayInTicks = obj->fsmExecRateHz/1000 * 100; // 100 ms = default
 
     obj->numRegisteredPwmChannels = 0;
+    PLX_PWM_initGroup(&obj->pwmGroup);
 
     obj->pilMode = false;
 
@@ -59,6 +60,7 @@ void PLX_PWR_registerPwmChannel(PLX_PWM_Handle_t aChannel)
     PLX_ASSERT(obj->numRegisteredPwmChannels < PLX_PWR_MAX_PWM_CHANNELS);
     obj->pwmChannels[obj->numRegisteredPwmChannels] = aChannel;
     obj->numRegisteredPwmChannels++;
+    PLX_PWM_addToGroup(&obj->pwmGroup, aChannel);
 }
 
 void PLX_PWR_reset()
@@ -251,11 +253,7 @@ static void PLX_PWR_disableSwitching()
     EINT;
 
     // disable actuators
-    int i;
-    for(i=0; i< obj->numRegisteredPwmChannels; i++)
-    {
-        PLX_PWM_disableOut(obj->pwmChannels[i]);
-    }
+    PLX_PWM_disableGroupOut(&obj->pwmGroup);
     obj->gatesActive = false;
 }
 
@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2014-2020 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_svm.h"
+
+#define PLX_SVM_SQRT3_BY_2 0.86602540378f
+#define PLX_SVM_MIN_MAG_SQ 1.0e-6f
+
+#pragma CODE_SECTION(PLX_SVM_computeDuties, "ramfuncs")
+void PLX_SVM_computeDuties(PLX_SVM_Mode_t aMode, float aAlpha, float aBeta, float *aDuties)
+{
+    // inverse Clarke transformation
+    float va = aAlpha;
+    float vb = -0.5f * aAlpha + PLX_SVM_SQRT3_BY_2 * aBeta;
+    float vc = -0.5f * aAlpha - PLX_SVM_SQRT3_BY_2 * aBeta;
+
+    float vmax = (va > vb) ? va : vb;
+    vmax = (vc > vmax) ? vc : vmax;
+    float vmin = (va < vb) ? va : vb;
+    vmin = (vc < vmin) ? vc : vmin;
+
+    // zero-sequence component
+    float v0;
+    switch(aMode)
+    {
+        default:
+        case PLX_SVM_SINE:
+            v0 = 0.0f;
+            break;
+
+        case PLX_SVM_THI:
+        {
+            // -1/6*|v|*cos(3*theta), using va*vb*vc = |v|^3*cos(3*theta)/4
+            float magSq = aAlpha * aAlpha + aBeta * aBeta;
+            if(magSq > PLX_SVM_MIN_MAG_SQ)
+            {
+#ifdef __TMS320C28XX_TMU__
+                // hardware divide on the TMU instead of the RTS division routine
+                v0 = __divf32(-(2.0f/3.0f) * va * vb * vc, magSq);
+#else
+                v0 = -(2.0f/3.0f) * va * vb * vc / magSq;
+#endif
+            }
+            else
+            {
+                v0 = 0.0f;
+            }
+            break;
+        }
+
+        case PLX_SVM_SVPWM:
+            v0 = -0.5f * (vmax + vmin);
+            break;
+
+        case PLX_SVM_DPWM1:
+            // clamp the phase with the largest magnitude
+            v0 = ((vmax + vmin) >= 0.0f) ? (1.0f - vmax) : (-1.0f - vmin);
+            break;
+
+        case PLX_SVM_DPWMMAX:
+            v0 = 1.0f - vmax;
+            break;
+
+        case PLX_SVM_DPWMMIN:
+            v0 = -1.0f - vmin;
+            break;
+    }
+
+    // saturation is left to the PWM driver
+    aDuties[0] = 0.5f + 0.5f * (va + v0);
+    aDuties[1] = 0.5f + 0.5f * (vb + v0);
+    aDuties[2] = 0.5f + 0.5f * (vc + v0);
+}
+
+#pragma CODE_SECTION(PLX_SVM_setDuties, "ramfuncs")
+void PLX_SVM_setDuties(const PLX_PWM_Handle_t *aHandles, PLX_SVM_Mode_t aMode, float aAlpha, float aBeta)
+{
+    float duties[3];
+    PLX_SVM_computeDuties(aMode, aAlpha, aBeta, duties);
+    PLX_PWM_setDutyN(aHandles, duties, 3);
+}
+
+#pragma CODE_SECTION(PLX_SVM_setMultiLevelDutyN, "ramfuncs")
+void PLX_SVM_setMultiLevelDutyN(const PLX_PWM_Handle_t *aHandles, const float *aRefs, uint16_t aNumPhases, uint16_t aModulesPerPhase)
+{
+    float span = (float)aModulesPerPhase;
+    float halfSpan = 0.5f * span;
+    uint16_t p, k;
+
+    PLX_ASSERT((aModulesPerPhase > 0) && (aModulesPerPhase <= PLX_SVM_MAX_LEVEL_MODULES));
+    for(p=0; p<aNumPhases; p++)
+    {
+        const PLX_PWM_Handle_t *handles = &aHandles[p * aModulesPerPhase];
+
+        // position within the stacked carrier bands (0..aModulesPerPhase)
+        float x = (aRefs[p] + 1.0f) * halfSpan;
+        x = (x < 0.0f) ? 0.0f : x;
+        x = (x > span) ? span : x;
+
+        // only the band owner modulates, the others take the compare
+        // values of 0 and 100% duty directly from the cached scaling
+        uint16_t band = (uint16_t)x;
+        band = (band >= aModulesPerPhase) ? (aModulesPerPhase - 1) : band;
+        for(k=0; k<aModulesPerPhase; k++)
+        {
+            float offset, scale, cmp;
+            PLX_PWM_getDutyScaling(handles[k], &offset, &scale);
+            if(k < band)
+            {
+                cmp = offset + scale;
+            }
+            else if(k > band)
+            {
+                cmp = offset;
+            }
+            else
+            {
+                cmp = offset + scale * (x - (float)k);
+            }
+            cmp = (cmp > 65535.0f) ? 65535.0f : cmp;
+            PLX_PWM_setCompare(handles[k], (uint16_t)cmp);
+        }
+    }
+}
@@ -0,0 +1,575 @@
+/*
+   Copyright (c) 2014-2021 by Plexim GmbH
+   All rights reserved.
+
+   A free license is granted to anyone to use this software for any legal
+   non safety-critical purpose, including commercial applications, provided
+   that:
+   1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+   2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+ */
+
+#include "plx_xcp.h"
+
+// commands
+#define XCP_CMD_CONNECT                 0xFF
+#define XCP_CMD_DISCONNECT              0xFE
+#define XCP_CMD_GET_STATUS              0xFD
+#define XCP_CMD_SYNCH                   0xFC
+#define XCP_CMD_SET_MTA                 0xF6
+#define XCP_CMD_UPLOAD                  0xF5
+#define XCP_CMD_SHORT_UPLOAD            0xF4
+#define XCP_CMD_USER_CMD                0xF1
+#define XCP_CMD_DOWNLOAD                0xF0
+#define XCP_CMD_SHORT_DOWNLOAD          0xED
+#define XCP_CMD_SET_DAQ_PTR             0xE2
+#define XCP_CMD_WRITE_DAQ               0xE1
+#define XCP_CMD_SET_DAQ_LIST_MODE       0xE0
+#define XCP_CMD_START_STOP_DAQ_LIST     0xDE
+#define XCP_CMD_START_STOP_SYNCH        0xDD
+#define XCP_CMD_GET_DAQ_PROCESSOR_INFO  0xDA
+#define XCP_CMD_FREE_DAQ                0xD6
+#define XCP_CMD_ALLOC_DAQ               0xD5
+#define XCP_CMD_ALLOC_ODT               0xD4
+#define XCP_CMD_ALLOC_ODT_ENTRY         0xD3
+
+// user commands (probe table)
+#define XCP_USER_GET_NUM_PROBES         0x00
+#define XCP_USER_GET_PROBE              0x01
+
+// packet identifiers and error codes
+#define XCP_PID_RES                     0xFF
+#define XCP_PID_ERR                     0xFE
+#define XCP_ERR_CMD_SYNCH               0x00
+#define XCP_ERR_CMD_BUSY                0x10
+#define XCP_ERR_CMD_UNKNOWN             0x20
+#define XCP_ERR_CMD_SYNTAX              0x21
+#define XCP_ERR_OUT_OF_RANGE            0x22
+#define XCP_ERR_ACCESS_DENIED           0x24
+#define XCP_ERR_WRITE_PROTECTED         0x25
+#define XCP_ERR_DAQ_ACTIVE              0x2A
+#define XCP_ERR_MEMORY_OVERFLOW         0x30
+
+#define XCP_RESOURCE_CAL_PAG            0x01
+#define XCP_RESOURCE_DAQ                0x04
+#define XCP_COMM_MODE_AG_WORD           0x02
+#define XCP_SESSION_DAQ_RUNNING         0x40
+
+static uint32_t PLX_XCP_getU32(const unsigned char *aBytes)
+{
+    return ((uint32_t)(aBytes[0] & 0xFF)) |
+           ((uint32_t)(aBytes[1] & 0xFF) << 8) |
+           ((uint32_t)(aBytes[2] & 0xFF) << 16) |
+           ((uint32_t)(aBytes[3] & 0xFF) << 24);
+}
+
+static void PLX_XCP_putU16(unsigned char *aBytes, uint16_t aVal)
+{
+    aBytes[0] = aVal & 0xFF;
+    aBytes[1] = (aVal >> 8) & 0xFF;
+}
+
+static void PLX_XCP_putU32(unsigned char *aBytes, uint32_t aVal)
+{
+    PLX_XCP_putU16(&aBytes[0], (uint16_t)aVal);
+    PLX_XCP_putU16(&aBytes[2], (uint16_t)(aVal >> 16));
+}
+
+static uint16_t PLX_XCP_getProbeWords(PLX_XCP_ProbeType_t aType)
+{
+    return ((aType == PLX_XCP_UINT16) || (aType == PLX_XCP_INT16)) ? 1 : 2;
+}
+
+static bool PLX_XCP_isDaqRunning(PLX_XCP_Obj_t *obj)
+{
+    int i;
+    for(i=0; i<obj->numDaqLists; i++){
+        if(obj->daq[i].running){
+            return true;
+        }
+    }
+    return false;
+}
+
+static void PLX_XCP_stopAllDaq(PLX_XCP_Obj_t *obj)
+{
+    int i;
+    for(i=0; i<PLX_XCP_MAX_DAQ_LISTS; i++){
+        obj->daq[i].running = false;
+        obj->daq[i].selected = false;
+    }
+}
+
+static void PLX_XCP_freeDaq(PLX_XCP_Obj_t *obj)
+{
+    PLX_XCP_stopAllDaq(obj);
+    obj->numDaqLists = 0;
+    int i;
+    for(i=0; i<PLX_XCP_MAX_DAQ_LISTS; i++){
+        obj->daq[i].numEntries = 0;
+        obj->daq[i].numOdts = 0;
+        obj->daq[i].event = 0;
+        obj->daq[i].prescaler = 1;
+        obj->daq[i].counter = 0;
+    }
+}
+
+// returns the number of response bytes, 0 for no response
+static uint16_t PLX_XCP_error(PLX_XCP_Obj_t *obj, unsigned char aCode)
+{
+    obj->res[0] = XCP_PID_ERR;
+    obj->res[1] = aCode;
+    return 2;
+}
+
+static uint16_t PLX_XCP_download(PLX_XCP_Obj_t *obj, uint16_t aWords, const unsigned char *aData)
+{
+    if(obj->calPending){
+        return PLX_XCP_error(obj, XCP_ERR_CMD_BUSY);
+    }
+
+    // writes are restricted to complete calibrations
+    const PLX_XCP_Probe_t *probe = NULL;
+    int i;
+    for(i=0; i<obj->par.numProbes; i++){
+        if(obj->par.probes[i].writable && ((uint32_t)obj->par.probes[i].addr == obj->mta)){
+            probe = &obj->par.probes[i];
+            break;
+        }
+    }
+    if(probe == NULL){
+        return PLX_XCP_error(obj, XCP_ERR_ACCESS_DENIED);
+    }
+    if(aWords != PLX_XCP_getProbeWords(probe->type)){
+        return PLX_XCP_error(obj, XCP_ERR_WRITE_PROTECTED);
+    }
+
+    uint16_t data[2];
+    data[0] = (aData[0] & 0xFF) | ((aData[1] & 0xFF) << 8);
+    data[1] = (aWords > 1) ? ((aData[2] & 0xFF) | ((aData[3] & 0xFF) << 8)) : 0;
+    uint32_t raw = ((uint32_t)data[1] << 16) | data[0];
+
+    float val;
+    switch(probe->type){
+        case PLX_XCP_UINT16:
+            val = (float)data[0];
+            break;
+        case PLX_XCP_INT16:
+            val = (float)(int16_t)data[0];
+            break;
+        case PLX_XCP_UINT32:
+            val = (float)raw;
+            break;
+        case PLX_XCP_INT32:
+            val = (float)(int32_t)raw;
+            break;
+        default:
+        {
+            union { uint32_t u; float f; } conv;
+            conv.u = raw;
+            val = conv.f;
+            break;
+        }
+    }
+    if(!(val >= probe->min) || !(val <= probe->max)){
+        return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+    }
+
+    // applied by PLX_XCP_taskEnd() at the next quiet task boundary
+    obj->calAddr = (uint16_t *)probe->addr;
+    obj->calWords = aWords;
+    obj->calData[0] = data[0];
+    obj->calData[1] = data[1];
+    obj->calPending = true;
+
+    obj->mta += aWords;
+    obj->res[0] = XCP_PID_RES;
+    return 1;
+}
+
+static uint16_t PLX_XCP_upload(PLX_XCP_Obj_t *obj, uint16_t aWords)
+{
+    // one alignment byte for word granularity
+    if((aWords == 0) || (2 + 2*aWords > obj->par.ctoLen)){
+        return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+    }
+    obj->res[0] = XCP_PID_RES;
+    obj->res[1] = 0;
+    volatile uint16_t *src = (volatile uint16_t *)obj->mta;
+    int i;
+    for(i=0; i<aWords; i++){
+        PLX_XCP_putU16(&obj->res[2 + 2*i], src[i]);
+    }
+    obj->mta += aWords;
+    return 2 + 2*aWords;
+}
+
+static uint16_t PLX_XCP_processCommand(PLX_XCP_Obj_t *obj)
+{
+    const unsigned char *cmd = &obj->cmd[0];
+    unsigned char pid = cmd[0] & 0xFF;
+
+    if(pid == XCP_CMD_CONNECT){
+        obj->connected = true;
+        obj->res[0] = XCP_PID_RES;
+        obj->res[1] = XCP_RESOURCE_CAL_PAG | XCP_RESOURCE_DAQ;
+        obj->res[2] = XCP_COMM_MODE_AG_WORD;
+        obj->res[3] = obj->par.ctoLen;
+        PLX_XCP_putU16(&obj->res[4], obj->par.dtoLen);
+        obj->res[6] = 1; // protocol layer version
+        obj->res[7] = 1; // transport layer version
+        return 8;
+    }
+    if(!obj->connected){
+        return 0; // silent until connected
+    }
+
+    switch(pid){
+        case XCP_CMD_DISCONNECT:
+            PLX_XCP_stopAllDaq(obj);
+            obj->connected = false;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+
+        case XCP_CMD_GET_STATUS:
+            obj->res[0] = XCP_PID_RES;
+            obj->res[1] = PLX_XCP_isDaqRunning(obj) ? XCP_SESSION_DAQ_RUNNING : 0;
+            obj->res[2] = 0; // no resource protection
+            obj->res[3] = 0;
+            PLX_XCP_putU16(&obj->res[4], 0);
+            return 6;
+
+        case XCP_CMD_SYNCH:
+            return PLX_XCP_error(obj, XCP_ERR_CMD_SYNCH);
+
+        case XCP_CMD_SET_MTA:
+            obj->mta = PLX_XCP_getU32(&cmd[4]);
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+
+        case XCP_CMD_UPLOAD:
+            return PLX_XCP_upload(obj, cmd[1] & 0xFF);
+
+        case XCP_CMD_SHORT_UPLOAD:
+            obj->mta = PLX_XCP_getU32(&cmd[4]);
+            return PLX_XCP_upload(obj, cmd[1] & 0xFF);
+
+        case XCP_CMD_DOWNLOAD:
+            if(2 + 2*(cmd[1] & 0xFF) > obj->par.ctoLen){
+                return PLX_XCP_error(obj, XCP_ERR_CMD_SYNTAX);
+            }
+            return PLX_XCP_download(obj, cmd[1] & 0xFF, &cmd[2]);
+
+        case XCP_CMD_SHORT_DOWNLOAD:
+            if(8 + 2*(cmd[1] & 0xFF) > obj->par.ctoLen){
+                return PLX_XCP_error(obj, XCP_ERR_CMD_SYNTAX);
+            }
+            obj->mta = PLX_XCP_getU32(&cmd[4]);
+            return PLX_XCP_download(obj, cmd[1] & 0xFF, &cmd[8]);
+
+        case XCP_CMD_USER_CMD:
+            if((cmd[1] & 0xFF) == XCP_USER_GET_NUM_PROBES){
+                obj->res[0] = XCP_PID_RES;
+                PLX_XCP_putU16(&obj->res[1], obj->par.numProbes);
+                return 3;
+            } else if((cmd[1] & 0xFF) == XCP_USER_GET_PROBE){
+                uint16_t idx = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+                if(idx >= obj->par.numProbes){
+                    return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+                }
+                const PLX_XCP_Probe_t *probe = &obj->par.probes[idx];
+                obj->res[0] = XCP_PID_RES;
+                obj->res[1] = PLX_XCP_getProbeWords(probe->type);
+                obj->res[2] = probe->type | (probe->writable ? 0x80 : 0);
+                obj->res[3] = 0;
+                PLX_XCP_putU32(&obj->res[4], (uint32_t)probe->addr);
+                return 8;
+            }
+            return PLX_XCP_error(obj, XCP_ERR_CMD_UNKNOWN);
+
+        case XCP_CMD_GET_DAQ_PROCESSOR_INFO:
+            obj->res[0] = XCP_PID_RES;
+            obj->res[1] = 0x03; // dynamic configuration, prescaler supported
+            PLX_XCP_putU16(&obj->res[2], obj->par.numDaqLists);
+            PLX_XCP_putU16(&obj->res[4], obj->par.numEvents);
+            obj->res[6] = 0; // no predefined lists
+            obj->res[7] = 0; // absolute ODT number
+            return 8;
+
+        case XCP_CMD_FREE_DAQ:
+            DINT; // PLX_XCP_taskEnd() must not see a partial configuration
+            PLX_XCP_freeDaq(obj);
+            EINT;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+
+        case XCP_CMD_ALLOC_DAQ:
+        {
+            uint16_t count = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            if(PLX_XCP_isDaqRunning(obj)){
+                return PLX_XCP_error(obj, XCP_ERR_DAQ_ACTIVE);
+            }
+            if(count > obj->par.numDaqLists){
+                return PLX_XCP_error(obj, XCP_ERR_MEMORY_OVERFLOW);
+            }
+            obj->numDaqLists = count;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_ALLOC_ODT:
+        {
+            uint16_t daq = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            if(daq >= obj->numDaqLists){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            if((cmd[4] & 0xFF) > 1){
+                return PLX_XCP_error(obj, XCP_ERR_MEMORY_OVERFLOW); // one frame per list
+            }
+            obj->daq[daq].numOdts = cmd[4] & 0xFF;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_ALLOC_ODT_ENTRY:
+        {
+            uint16_t daq = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            uint16_t count = cmd[5] & 0xFF;
+            if((daq >= obj->numDaqLists) || ((cmd[4] & 0xFF) >= obj->daq[daq].numOdts)){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            if((count > PLX_XCP_MAX_ODT_ENTRIES) || (1 + 2*count > obj->par.dtoLen)){
+                return PLX_XCP_error(obj, XCP_ERR_MEMORY_OVERFLOW);
+            }
+            int i;
+            for(i=0; i<count; i++){
+                obj->daq[daq].entries[i].addr = 0;
+                obj->daq[daq].entries[i].size = 0; // skipped until written
+            }
+            obj->daq[daq].numEntries = count;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_SET_DAQ_PTR:
+        {
+            uint16_t daq = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            if((daq >= obj->numDaqLists) || ((cmd[4] & 0xFF) >= obj->daq[daq].numOdts) ||
+               ((cmd[5] & 0xFF) >= obj->daq[daq].numEntries)){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            obj->daqPtrList = daq;
+            obj->daqPtrEntry = cmd[5] & 0xFF;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_WRITE_DAQ:
+        {
+            PLX_XCP_DaqList_t *daq = &obj->daq[obj->daqPtrList];
+            uint16_t size = cmd[2] & 0xFF;
+            if(daq->running){
+                return PLX_XCP_error(obj, XCP_ERR_DAQ_ACTIVE);
+            }
+            if((obj->daqPtrEntry >= daq->numEntries) || (size == 0) || (size > 2)){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            // payload must fit into a single frame
+            uint16_t words = size;
+            int i;
+            for(i=0; i<daq->numEntries; i++){
+                if(i != obj->daqPtrEntry){
+                    words += daq->entries[i].size;
+                }
+            }
+            if(1 + 2*words > obj->par.dtoLen){
+                return PLX_XCP_error(obj, XCP_ERR_MEMORY_OVERFLOW);
+            }
+            daq->entries[obj->daqPtrEntry].addr = PLX_XCP_getU32(&cmd[4]);
+            daq->entries[obj->daqPtrEntry].size = size;
+            obj->daqPtrEntry++; // auto-increment
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_SET_DAQ_LIST_MODE:
+        {
+            uint16_t daq = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            uint16_t event = (cmd[4] & 0xFF) | ((cmd[5] & 0xFF) << 8);
+            if((daq >= obj->numDaqLists) || (event >= obj->par.numEvents) || ((cmd[6] & 0xFF) == 0)){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            if(obj->daq[daq].running){
+                return PLX_XCP_error(obj, XCP_ERR_DAQ_ACTIVE);
+            }
+            obj->daq[daq].event = event;
+            obj->daq[daq].prescaler = cmd[6] & 0xFF;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        case XCP_CMD_START_STOP_DAQ_LIST:
+        {
+            uint16_t daq = (cmd[2] & 0xFF) | ((cmd[3] & 0xFF) << 8);
+            if((daq >= obj->numDaqLists) || (obj->daq[daq].numOdts == 0)){
+                return PLX_XCP_error(obj, XCP_ERR_OUT_OF_RANGE);
+            }
+            switch(cmd[1] & 0xFF){
+                case 0:
+                    obj->daq[daq].running = false;
+                    break;
+                case 1:
+                    obj->daq[daq].counter = 0;
+                    obj->daq[daq].running = true;
+                    break;
+                case 2:
+                    obj->daq[daq].selected = true;
+                    break;
+                default:
+                    return PLX_XCP_error(obj, XCP_ERR_CMD_SYNTAX);
+            }
+            obj->res[0] = XCP_PID_RES;
+            obj->res[1] = daq; // first PID
+            return 2;
+        }
+
+        case XCP_CMD_START_STOP_SYNCH:
+        {
+            int i;
+            unsigned char mode = cmd[1] & 0xFF;
+            if(mode > 2){
+                return PLX_XCP_error(obj, XCP_ERR_CMD_SYNTAX);
+            }
+            DINT; // selected lists start or stop with the same event
+            for(i=0; i<obj->numDaqLists; i++){
+                if(mode == 0){
+                    obj->daq[i].running = false;
+                } else if(obj->daq[i].selected){
+                    obj->daq[i].counter = 0;
+                    obj->daq[i].running = (mode == 1);
+                }
+                obj->daq[i].selected = false;
+            }
+            EINT;
+            obj->res[0] = XCP_PID_RES;
+            return 1;
+        }
+
+        default:
+            return PLX_XCP_error(obj, XCP_ERR_CMD_UNKNOWN);
+    }
+}
+
+void PLX_XCP_sinit()
+{
+    ;
+}
+
+PLX_XCP_Handle_t PLX_XCP_init(void *aMemory, const size_t aNumBytes){
+    if(aNumBytes < sizeof(PLX_XCP_Obj_t))
+    {
+        return((PLX_XCP_Handle_t)NULL);
+    }
+    PLX_XCP_Handle_t handle = (PLX_XCP_Handle_t)aMemory;
+    return handle;
+}
+
+void PLX_XCP_configure(PLX_XCP_Handle_t aHandle, const PLX_XCP_Params_t *aParams)
+{
+    PLX_XCP_Obj_t *obj = (PLX_XCP_Obj_t *)aHandle;
+
+    PLX_ASSERT(aParams->numDaqLists <= PLX_XCP_MAX_DAQ_LISTS);
+    PLX_ASSERT((aParams->ctoLen >= 8) && (aParams->ctoLen <= PLX_XCP_MAX_FRAME_LEN));
+    PLX_ASSERT((aParams->dtoLen >= 8) && (aParams->dtoLen <= PLX_XCP_MAX_FRAME_LEN));
+
+    obj->par = *aParams;
+    obj->connected = false;
+    obj->mta = 0;
+    obj->daqPtrList = 0;
+    obj->daqPtrEntry = 0;
+    obj->daqOverruns = 0;
+    obj->calPending = false;
+    PLX_XCP_freeDaq(obj);
+}
+
+void PLX_XCP_poll(PLX_XCP_Handle_t aHandle)
+{
+    PLX_XCP_Obj_t *obj = (PLX_XCP_Obj_t *)aHandle;
+
+    if(!obj->par.rx(obj->par.cmdMailbox, &obj->cmd[0], obj->par.ctoLen)){
+        return;
+    }
+    uint16_t len = PLX_XCP_processCommand(obj);
+    if(len == 0){
+        return;
+    }
+    // frames have a fixed length
+    int i;
+    for(i=len; i<obj->par.ctoLen; i++){
+        obj->res[i] = 0;
+    }
+    (void)obj->par.tx(obj->par.resMailbox, &obj->res[0], obj->par.ctoLen);
+}
+
+#pragma CODE_SECTION(PLX_XCP_taskEnd, "ramfuncs")
+void PLX_XCP_taskEnd(PLX_XCP_Handle_t aHandle, uint16_t aTaskId, bool aTasksIdle)
+{
+    PLX_XCP_Obj_t *obj = (PLX_XCP_Obj_t *)aHandle;
+
+    if(obj->calPending && aTasksIdle){
+        obj->calAddr[0] = obj->calData[0];
+        if(obj->calWords > 1){
+            obj->calAddr[1] = obj->calData[1];
+        }
+        obj->calPending = false;
+    }
+
+    int i;
+    for(i=0; i<obj->numDaqLists; i++){
+        PLX_XCP_DaqList_t *daq = &obj->daq[i];
+        if(!daq->running || (daq->event != aTaskId)){
+            continue;
+        }
+        if(++daq->counter < daq->prescaler){
+            continue;
+        }
+        daq->counter = 0;
+
+        unsigned char dto[PLX_XCP_MAX_FRAME_LEN];
+        uint16_t pos = 1;
+        dto[0] = i; // PID = absolute ODT number
+        int j;
+        for(j=0; j<daq->numEntries; j++){
+            if(daq->entries[j].size == 0){
+                continue;
+            }
+            volatile uint16_t *src = (volatile uint16_t *)daq->entries[j].addr;
+            PLX_XCP_putU16(&dto[pos], src[0]);
+            pos += 2;
+            if(daq->entries[j].size > 1){
+                PLX_XCP_putU16(&dto[pos], src[1]);
+                pos += 2;
+            }
+        }
+        for(; pos<obj->par.dtoLen; pos++){
+            dto[pos] = 0;
+        }
+        if(!obj->par.tx(obj->par.dtoMailboxes[i], &dto[0], obj->par.dtoLen)){
+            obj->daqOverruns++;
+        }
+    }
+}
+
+uint32_t PLX_XCP_getDaqOverruns(PLX_XCP_Handle_t aHandle)
+{
+    PLX_XCP_Obj_t *obj = (PLX_XCP_Obj_t *)aHandle;
+    return obj->daqOverruns;
+}
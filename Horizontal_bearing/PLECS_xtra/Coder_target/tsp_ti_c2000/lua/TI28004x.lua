@@ -81,6 +81,7 @@ function T.configure(resources)
   resources:add("SCI B")
   resources:add("SCI C")
   resources:add("EST-0")
+  resources:add("CLA TASK", 1, 8)
   resources:add("EXTSYNC", 1, 2)
   resources:add("CMPSS", 1, 7)
   resources:add("XBAR_INPUT", 1, 16)
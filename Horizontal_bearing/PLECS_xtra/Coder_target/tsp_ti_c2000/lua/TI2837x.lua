@@ -87,7 +87,9 @@ function T.configure(resources)
   resources:add("SCI B")
   resources:add("SCI C")
   resources:add("SCI D")
+  resources:add("CLA TASK", 1, 8)
   resources:add("EXTSYNC", 1, 2)
+  resources:add("DMA", 1, 6)
   resources:add("CMPSS", 1, 8)
   resources:add("XBAR_INPUT", 1, 16)
   resources:add("XBAR_TRIP", 4, 12)
@@ -113,6 +115,7 @@ function T.getTargetParameters()
       }
     },
     adcs = {type = 4, num_channels = 16, vref = 3.0},
+    dmas = {num_channels = 6},
     dacs = {min_out = 0.0, max_out = 3.0},
     qeps = {
     },
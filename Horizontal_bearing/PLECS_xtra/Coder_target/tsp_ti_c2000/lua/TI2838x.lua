@@ -87,7 +87,23 @@ function T.configure(resources)
   resources:add("SCI B")
   resources:add("SCI C")
   resources:add("SCI D")
+  resources:add("FSITX A")
+  resources:add("FSITX B")
+  resources:add("FSIRX A")
+  resources:add("FSIRX B")
+  resources:add("FSIRX C")
+  resources:add("FSIRX D")
+  resources:add("FSIRX E")
+  resources:add("FSIRX F")
+  resources:add("FSIRX G")
+  resources:add("FSIRX H")
+  resources:add("SDFM1-FLT", 1, 4)
+  resources:add("SDFM2-FLT", 1, 4)
+  resources:add("I2C A")
+  resources:add("I2C B")
+  resources:add("CLA TASK", 1, 8)
   resources:add("EXTSYNC", 1, 2)
+  resources:add("DMA", 1, 6)
   resources:add("CMPSS", 1, 8)
   resources:add("XBAR_INPUT", 1, 16)
   resources:add("XBAR_TRIP", 4, 12)
@@ -115,6 +131,10 @@ function T.getTargetParameters()
       }
     },
     adcs = {type = 4, num_channels = 16, vref = 3.0},
+    dmas = {num_channels = 6},
+    fsis = {num_tx = 2, num_rx = 8, max_clk = 50e6},
+    sdfms = {num_units = 2, num_channels = 4},
+    i2cs = {num_units = 2, fifo_depth = 16, max_bit_rate = 400e3},
     dacs = {min_out = 0.0, max_out = 3.0},
     qeps = {
     },
@@ -18,7 +18,13 @@
 --]] --
 local Module = {}
 
-local static = {numInstances = 0, instances = {}, finalized = nil}
+local static = {
+  numInstances = 0,
+  instances = {},
+  finalized = nil,
+  oversampling = nil,
+  capture = nil
+}
 
 function Module.getBlock(globals)
 
@@ -36,6 +42,8 @@ function Module.getBlock(globals)
   function Adc:getDirectFeedthroughCode()
     local Require = ResourceList:new()
     local InitCode = StringList:new()
+    local OutputCode = StringList:new()
+    local Declarations = StringList:new()
     local OutputSignal = StringList:new()
     local TriggerOutputSignal = StringList:new()
 
@@ -47,7 +55,15 @@ function Module.getBlock(globals)
     -- triggered
     self.num_channels = Block.NumOutputSignals[1]
     self.channels = {}
+    self.num_socs = 0
+    -- high priority SOCs (SOC0..num_high_socs-1) are converted before any
+    -- round-robin SOC, the task interrupt is raised when they complete
+    self.num_high_socs = 0
     self.totalConversionTimeInAcqps = 0
+    self.highPriorityConversionTimeInAcqps = 0
+    -- channels converted together by a single PLXHAL_ADC_getFrame() call
+    local frameMask = 0
+    local frameVarName = "adc%iFrame" % {self.instance}
 
     if self.num_channels >
         globals.target.getTargetParameters()['adcs']['num_channels'] then
@@ -67,8 +83,6 @@ function Module.getBlock(globals)
 
 
     for i = 1, self.num_channels do
-      Require:add('%s-SOC' % {adcId}, i - 1)
-
       local input = Block.Mask.input[i]
       if input > 15 then
         return "AIN%i is not a valid input for for %s." % {input, adcId}
@@ -83,7 +97,37 @@ function Module.getBlock(globals)
         end
       end
       local ACQPS = globals.target.calcACQPS(ts,self.sigmode)
-      self.totalConversionTimeInAcqps = self.totalConversionTimeInAcqps + ACQPS
+
+      local oversampling = 1
+      if Block.Mask.oversampling ~= nil then
+        oversampling = globals.utils.getFromArrayOrScalar(Block.Mask.oversampling, i,
+                                                          self.num_channels)
+        if oversampling == nil then
+          return "Invalid width of parameter 'oversampling'."
+        end
+      end
+      if (oversampling ~= 1) and (oversampling ~= 2) and (oversampling ~= 4)
+          and (oversampling ~= 8) and (oversampling ~= 16) then
+        return "Oversampling must be 1, 2, 4, 8 or 16."
+      end
+      if (oversampling > 1) and (adcType == 2) then
+        return 'This chip does not support ADC oversampling.'
+      end
+
+      local priority = 0
+      if Block.Mask.priority ~= nil then
+        priority = globals.utils.getFromArrayOrScalar(Block.Mask.priority, i,
+                                                      self.num_channels)
+        if priority == nil then
+          return "Invalid width of parameter 'high priority'."
+        end
+      end
+      if (priority ~= 0) and (priority ~= 1) then
+        return "High priority must be 0 or 1."
+      end
+      if (priority == 1) and (adcType == 2) then
+        return 'This chip does not support high priority SOCs.'
+      end
 
       local scale = globals.utils.getFromArrayOrScalar(Block.Mask.scale, i,
                                                        self.num_channels)
@@ -102,9 +146,133 @@ function Module.getBlock(globals)
         port = port,
         scale = scale,
         offset = offset,
-        ACQPS = ACQPS
+        ACQPS = ACQPS,
+        oversampling = oversampling,
+        priority = priority
       }
-      OutputSignal:append("PLXHAL_ADC_getIn(%i, %i)" % {self.instance, i - 1})
+    end
+
+    -- assign SOCs: high priority channels first, followed by their additional
+    -- oversampling conversions, then the round-robin channels and their
+    -- additional conversions
+    for _, prio in ipairs({1, 0}) do
+      for _, p in ipairs(self.channels) do
+        if p.priority == prio then
+          p.soc = self.num_socs
+          self.num_socs = self.num_socs + 1
+        end
+      end
+      for _, p in ipairs(self.channels) do
+        if p.priority == prio then
+          p.extraSoc = self.num_socs
+          if self.num_socs + p.oversampling - 1 >
+              globals.target.getTargetParameters()['adcs']['num_channels'] then
+            return 'Not enough free SOCs for the requested oversampling.'
+          end
+          self.num_socs = self.num_socs + p.oversampling - 1
+          local acqps = p.oversampling * p.ACQPS
+          self.totalConversionTimeInAcqps = self.totalConversionTimeInAcqps + acqps
+          if prio == 1 then
+            self.highPriorityConversionTimeInAcqps =
+                self.highPriorityConversionTimeInAcqps + acqps
+          end
+        end
+      end
+      if prio == 1 then
+        self.num_high_socs = self.num_socs
+      end
+    end
+
+    for s = 0, self.num_socs - 1 do
+      Require:add('%s-SOC' % {adcId}, s)
+    end
+
+    for i, p in ipairs(self.channels) do
+      if p.oversampling > 1 then
+        static.oversampling = true
+        OutputSignal:append("PLXHAL_ADC_getInOversampled(%i, %i)" % {self.instance, p.soc})
+      else
+        frameMask = frameMask | (1 << p.soc)
+        OutputSignal:append("%s[%i]" % {frameVarName, p.soc})
+      end
+    end
+
+    if frameMask ~= 0 then
+      OutputCode:append('float %s[%i];\n' % {frameVarName, self.num_socs})
+      OutputCode:append('PLXHAL_ADC_getFrame(%i, %s, 0x%04X);\n' %
+                            {self.instance, frameVarName, frameMask})
+    end
+
+    -- DMA capture of all SOC results into a ring buffer
+    self.capture_depth = 0
+    if (Block.Mask.capture_depth ~= nil) and (Block.Mask.capture_depth > 0) then
+      if globals.target.getTargetParameters()['dmas'] == nil then
+        return 'This chip does not support DMA capture of ADC results.'
+      end
+      if Block.Mask.capture_depth < 2 then
+        return 'Capture depth must be at least 2 frames.'
+      end
+      -- buffers share a single 4k GS RAM block (see linker command files)
+      if Block.Mask.capture_depth * self.num_socs > 0x1000 then
+        return 'Capture buffer exceeds the DMA accessible RAM (4096 words).'
+      end
+      self.capture_depth = Block.Mask.capture_depth
+      self.capture_post = Block.Mask.capture_post
+      if self.capture_post == nil then
+        self.capture_post = 0
+      end
+      if self.capture_post >= self.capture_depth then
+        return 'Post-trigger frames must be smaller than the capture depth.'
+      end
+      -- allocate DMA channels from the top, ADC A uses CH6
+      self.capture_dma = globals.target.getTargetParameters()['dmas']['num_channels'] - self.adc
+      Require:add('DMA', self.capture_dma)
+      static.capture = true
+      if Target.Variables.targetCore == 2 then
+        -- GS14 must be assigned to CPU2 by the primary core (see syscfg.lua)
+        globals.syscfg:setEntry('dmaram', {core = 2})
+      end
+
+      if (type(Target.Variables.EXTERNAL_MODE) == 'number') and
+          (Target.Variables.EXTERNAL_MODE == 1) then
+        -- grab (singleton) pil object
+        local pil_obj
+        for _, b in ipairs(globals.instances) do
+          if b:getType() == 'pil' then
+            pil_obj = b
+          end
+        end
+        if pil_obj == nil then
+          pil_obj = self:makeBlock('pil')
+          local declaration = pil_obj:createImplicit()
+          Declarations:append(declaration)
+        end
+
+        -- command: 1 = arm, 2 = trigger
+        local probe = 'adc%iCapture' % {self.instance}
+        pil_obj:registerCalibration('%sCmd' % {probe}, {
+          type = 'uint16_t', val = 0, min = 0, max = 2
+        })
+        pil_obj:registerReadProbe('%sState' % {probe}, {type = 'uint16_t'})
+        pil_obj:registerReadProbe('%sStart' % {probe}, {type = 'uint16_t'})
+        pil_obj:registerReadProbe('%sTrigger' % {probe}, {type = 'uint16_t'})
+
+        local probes = '%s_probes.%s' % {Target.Variables.BASE_NAME, probe}
+        OutputCode:append('if(%sCmd == 1)\n' % {probes})
+        OutputCode:append('{\n  PLXHAL_ADC_armCapture(%i);\n}\n' % {self.instance})
+        OutputCode:append('else if(%sCmd == 2)\n' % {probes})
+        OutputCode:append('{\n  PLXHAL_ADC_triggerCapture(%i);\n}\n' % {self.instance})
+        OutputCode:append('%sCmd = 0;\n' % {probes})
+        OutputCode:append('PLXHAL_ADC_pollCapture(%i);\n' % {self.instance})
+        OutputCode:append('%sState = PLXHAL_ADC_getCaptureState(%i);\n' %
+                              {probes, self.instance})
+        OutputCode:append('%sStart = PLXHAL_ADC_getCaptureStartFrame(%i);\n' %
+                              {probes, self.instance})
+        OutputCode:append('%sTrigger = PLXHAL_ADC_getCaptureTriggerFrame(%i);\n' %
+                              {probes, self.instance})
+      else
+        OutputCode:append('PLXHAL_ADC_pollCapture(%i);\n' % {self.instance})
+      end
     end
 
     TriggerOutputSignal:append("{modtrig = {bid = %i}}" % {Adc:getId()})
@@ -115,7 +283,9 @@ function Module.getBlock(globals)
 	Require:add('ADC %s' % {string.char(65 + self.adc)})
 
     return {
+      Declarations = Declarations,
       InitCode = InitCode,
+      OutputCode = OutputCode,
       OutputSignal = {OutputSignal, TriggerOutputSignal},
       Require = Require,
       UserData = {bid = Adc:getId()}
@@ -227,6 +397,16 @@ function Module.getBlock(globals)
     if (globals.target.getTargetParameters()['adcs']['type']==4) and (self["sigmode"]>1) then
       c.PreInitCode:append("params.sigmode=%i;" % {self["sigmode"]})
     end
+    if self.num_high_socs > 0 then
+      local prictl = 'ADCSOCPRICTL'
+      if globals.target.getTargetParameters()['adcs']['type'] == 3 then
+        prictl = 'SOCPRICTL'
+      end
+      c.PreInitCode:append("// SOC0..SOC%i high priority, remaining SOCs round-robin" %
+                               {self.num_high_socs - 1})
+      c.PreInitCode:append("params.%s.bit.SOCPRIORITY = %i;" %
+                               {prictl, self.num_high_socs})
+    end
     c.PreInitCode:append(
         "PLX_AIN_configure(AdcHandles[%i], (PLX_AIN_Unit_t)%i, &params);" %
             {self.instance, self.adc})
@@ -235,17 +415,22 @@ function Module.getBlock(globals)
       if self['is_mod_trigger'] then
         isr = '%s_baseTaskInterrupt' % {Target.Variables.BASE_NAME}
       end
+      -- with high priority SOCs, don't wait for the round-robin conversions
+      local lastSoc = self.num_socs - 1
+      if self.num_high_socs > 0 then
+        lastSoc = self.num_high_socs - 1
+      end
       c.PreInitCode:append(globals.target.getAdcSetupCode(self.adc, {
         isr = isr,
-        INT1SEL = self.num_channels - 1,
+        INT1SEL = lastSoc,
         trig_is_timer = (TRIGSEL == 1)
       }))
     end
     c.PreInitCode:append('}')
 
-    for soc, p in ipairs(self.channels) do
+    for _, p in ipairs(self.channels) do
       c.PreInitCode:append(" // configure SOC%i of ADC-%s to measure ADCIN%i" %
-                               {soc, string.char(65 + self.adc), p["input"]})
+                               {p["soc"], string.char(65 + self.adc), p["input"]})
       c.PreInitCode:append("{\n")
       c.PreInitCode:append("  PLX_AIN_ChannelParams_t params;")
       c.PreInitCode:append("  PLX_AIN_setDefaultChannelParams(&params);")
@@ -258,13 +443,40 @@ function Module.getBlock(globals)
         c.PreInitCode:append("  params.ADCSOCxCTL.bit.TRIGSEL = %i;" % {TRIGSEL})
         c.PreInitCode:append("  params.ADCSOCxCTL.bit.ACQPS = %i;" %
                                  {p["ACQPS"]})
+        if p["oversampling"] > 1 then
+          c.PreInitCode:append("  // average %i conversions, additional ones on SOC%i..SOC%i" %
+                                   {p["oversampling"], p["extraSoc"], p["extraSoc"] + p["oversampling"] - 2})
+          c.PreInitCode:append("  params.oversampling = %i;" % {p["oversampling"]})
+          c.PreInitCode:append("  params.extraSoc = %i;" % {p["extraSoc"]})
+        end
       end
       c.PreInitCode:append(
           "  PLX_AIN_setupChannel(AdcHandles[%i], %i, %i, &params);" %
-              {self.instance, soc - 1, p["input"]})
+              {self.instance, p["soc"], p["input"]})
       c.PreInitCode:append("}\n")
     end
 
+    if self.capture_depth > 0 then
+      local buffer = 'AdcCapture%iBuf' % {self.instance}
+      c.Declarations:append('#pragma DATA_SECTION(%s, "dmaram")' % {buffer})
+      c.Declarations:append('uint16_t %s[%i];' %
+                                {buffer, self.capture_depth * self.num_socs})
+      if (type(Target.Variables.EXTERNAL_MODE) == 'number') and
+          (Target.Variables.EXTERNAL_MODE == 1) then
+        c.Declarations:append('PIL_SYMBOL_DEF(%s, 0, 1.0, "");' % {buffer})
+      end
+      c.PreInitCode:append(
+          " // capture %i frames of %i results with DMA CH%i, %i frames after trigger" %
+              {self.capture_depth, self.num_socs, self.capture_dma, self.capture_post})
+      c.PreInitCode:append(
+          "PLX_AIN_setupCapture(AdcHandles[%i], %i, %s, %i, %i, %i);" %
+              {
+                self.instance, self.capture_dma, buffer, self.capture_depth,
+                self.num_socs, self.capture_post
+              })
+      c.PreInitCode:append("PLX_AIN_armCapture(AdcHandles[%i]);" % {self.instance})
+    end
+
     if self['is_mod_trigger'] then
       itFunction = [[
       interrupt void %s_baseTaskInterrupt(void)
@@ -302,6 +514,43 @@ function Module.getBlock(globals)
         '  return PLX_AIN_getInF(AdcHandles[aHandle], aChannel);')
     c.Declarations:append('}')
 
+    c.Declarations:append(
+        'void PLXHAL_ADC_getFrame(uint16_t aHandle, float *aOut, uint16_t aMask){')
+    c.Declarations:append(
+        '  PLX_AIN_getFrameF(AdcHandles[aHandle], aOut, aMask);')
+    c.Declarations:append('}')
+
+    if static.oversampling ~= nil then
+      c.Declarations:append(
+          'float PLXHAL_ADC_getInOversampled(uint16_t aHandle, uint16_t aChannel){')
+      c.Declarations:append(
+          '  return PLX_AIN_getInOversampledF(AdcHandles[aHandle], aChannel);')
+      c.Declarations:append('}')
+    end
+
+    if static.capture ~= nil then
+      c.Declarations:append('void PLXHAL_ADC_armCapture(uint16_t aHandle){')
+      c.Declarations:append('  PLX_AIN_armCapture(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Declarations:append('void PLXHAL_ADC_triggerCapture(uint16_t aHandle){')
+      c.Declarations:append('  PLX_AIN_triggerCapture(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Declarations:append('void PLXHAL_ADC_pollCapture(uint16_t aHandle){')
+      c.Declarations:append('  PLX_AIN_pollCapture(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Declarations:append('uint16_t PLXHAL_ADC_getCaptureState(uint16_t aHandle){')
+      c.Declarations:append('  return PLX_AIN_getCaptureState(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Declarations:append('uint16_t PLXHAL_ADC_getCaptureStartFrame(uint16_t aHandle){')
+      c.Declarations:append('  return PLX_AIN_getCaptureStartFrame(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Declarations:append('uint16_t PLXHAL_ADC_getCaptureTriggerFrame(uint16_t aHandle){')
+      c.Declarations:append('  return PLX_AIN_getCaptureTriggerFrame(AdcHandles[aHandle]);')
+      c.Declarations:append('}')
+      c.Include:append('plx_dma.h')
+      c.PreInitCode:append('PLX_DMA_sinit();')
+    end
+
     local code = [[
     {
       PLX_AIN_sinit(%f, %i);
@@ -343,6 +592,10 @@ function Module.getBlock(globals)
   end
 
   function Adc:getTotalConversionTime()
+    -- the task interrupt only waits for the high priority group, if any
+    if self.num_high_socs > 0 then
+      return self.highPriorityConversionTimeInAcqps
+    end
     return self.totalConversionTimeInAcqps
   end
 
@@ -44,6 +44,7 @@ function Module.getBlock(globals)
   function Can:configure(params, req)
     self.gpio = params.gpio
     self.auto_buson = params.auto_buson
+    self.rx_interrupt = params.rx_interrupt
 
     if (globals.target.getFamilyPrefix() == '2833x') or (globals.target.getFamilyPrefix() == '2806x') then
       -- older targets require hard-coded pin-sets
@@ -58,6 +59,9 @@ function Module.getBlock(globals)
             self.gpio[1], self.gpio[2], string.char(65 + self.can)
           }
       end
+      if self.rx_interrupt then
+        return 'Interrupt-driven reception not supported by eCAN.'
+      end
     else
       -- newer targets have driverlib
       if globals.target.getFamilyPrefix() == '2837x' then
@@ -164,6 +168,9 @@ function Module.getBlock(globals)
     c.PreInitCode:append("  params.sam = %i;" % {0}) -- 1x ((3x sampling not supported on newer MCUs)
     c.PreInitCode:append("  params.brp = %i;" % {self.bt.brp})
     c.PreInitCode:append("  params.autoBusOn = %i;" % {self.auto_buson})
+    if self.pinset == nil then
+      c.PreInitCode:append("  params.rxInterrupt = %i;" % {self.rx_interrupt and 1 or 0})
+    end
     if self.pinset ~= nil then
         c.PreInitCode:append('PLX_CANBUS_configureViaPinSet(CanHandles[%i], PLX_CANBUS_CAN_%s, %i, &params);' %
             {self.instance, string.char(65 + self.can), self.pinset}
@@ -183,6 +190,35 @@ function Module.getBlock(globals)
               })
     end
     c.PreInitCode:append("}")
+
+    if self.rx_interrupt then
+      -- CAN interrupt 0 (PIE group 9) copies received frames into RAM
+      local isr = '%s_can%sRxInterrupt' % {Target.Variables.BASE_NAME, self.can_letter}
+      local itFunction = [[
+      interrupt void %(isr)s(void)
+      {
+        PLX_CANBUS_isr(CanHandles[%(instance)i]);
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP9;
+      }
+      ]]
+      c.Declarations:append("%s\n" % {itFunction % {
+        isr = isr,
+        instance = self.instance
+      }})
+
+      local isrConfigCode = [[
+      EALLOW;
+      PieVectTable.CAN%(unit)s0_INT = &%(isr)s;
+      EDIS;
+      PieCtrlRegs.PIEIER9.bit.INTx%(pie)i = 1;
+      ]]
+      c.PreInitCode:append(isrConfigCode % {
+        unit = self.can_letter,
+        isr = isr,
+        pie = 5 + 2*self.can -- CANA0: INTx5, CANB0: INTx7
+      })
+      c.InterruptEnableCode:append('IER |= M_INT9;')
+    end
     return c
   end
 
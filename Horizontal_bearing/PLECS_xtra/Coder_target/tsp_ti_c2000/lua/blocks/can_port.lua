@@ -85,13 +85,41 @@ function Module.getBlock(globals)
       gpio = Block.Mask.gpio,
       auto_buson = (Block.Mask.auto_buson == 2),
       bit_length_tq = bit_length_tq,
-      sjw_tq = sjw_tq
+      sjw_tq = sjw_tq,
+      rx_interrupt = (Block.Mask.RxInterrupt == Block.Mask.RxInterrupt) and
+                     (Block.Mask.RxInterrupt ~= nil) and (Block.Mask.RxInterrupt == 2)
     }, Require)
 
     if error ~= nil then
       return error
     end
 
+    -- optional measurement and calibration server on this port
+    if (Block.Mask.EnableXcp == Block.Mask.EnableXcp) and (Block.Mask.EnableXcp == 2) then
+      for _, id in ipairs({Block.Mask.XcpCmdId, Block.Mask.XcpResId, Block.Mask.XcpDtoId}) do
+        if (math.floor(id) ~= id) or (id < 0) or (id > 0x1FFFFFFF) then
+          return 'Invalid XCP CAN identifier.'
+        end
+      end
+      if (math.floor(Block.Mask.XcpDaqLists) ~= Block.Mask.XcpDaqLists) or
+         (Block.Mask.XcpDaqLists < 1) or (Block.Mask.XcpDaqLists > 4) then
+        return 'Number of XCP DAQ lists must be between 1 and 4.'
+      end
+      local xcp_obj = self:makeBlock('xcp')
+      local xcpError = xcp_obj:createImplicit({
+        can_obj = self.can_obj,
+        is_mcan = false,
+        cmd_id = Block.Mask.XcpCmdId,
+        res_id = Block.Mask.XcpResId,
+        dto_id = Block.Mask.XcpDtoId,
+        num_daq_lists = Block.Mask.XcpDaqLists,
+        brs = false
+      })
+      if xcpError ~= nil then
+        return xcpError
+      end
+    end
+
     OutputCode:append('{\n')
     OutputCode:append('  static bool lastBusOn = false;\n')
     OutputCode:append('  bool busOn = %s;\n' % {Block.InputSignal[1][1]})
@@ -23,7 +23,6 @@ TODO:
 - handle background task
 - figure out how to trigger on-time init task
 - does it make sense to allow tasks that are periodically triggered by s/w?
-- add resource management
 ]]
 
 local static = {numInstances = 0, instances = {}, finalized = nil}
@@ -57,7 +56,8 @@ function Module.getBlock(globals)
       taskNum = 8
     end
     
-    -- TODO: resource management - background is task 8
+    -- background is task 8
+    Require:add("CLA TASK", taskNum)
     
     self.task = {
       is_background = isBackgroundTask,
@@ -76,6 +76,23 @@ function Module.getBlock(globals)
     }
   end
   
+  -- task created on behalf of another block (e.g. CLA duty update of a PWM)
+  function Cla:createImplicit(params, req)
+    table.insert(static.instances, self.bid)
+
+    self.task = {
+      is_background = false,
+      num = params.task,
+      declarations = params.declarations,
+      include = params.include,
+      code = params.code
+    }
+    self['trig'] = params.trig
+    req:add("CLA TASK", params.task)
+
+    self:logLine('CLA task %i implicitly created.' % {params.task})
+  end
+
   function Cla:getNonDirectFeedthroughCode()
     local trig = Block.InputSignal[1][1]
     
@@ -96,14 +113,13 @@ function Module.getBlock(globals)
   end
   
   function Cla:setSinkForTriggerSource(sink)
-    if self['trig_exp'] == nil then
+    if self['trig_exp'] ~= nil then
+      local trig = eval(self['trig_exp'])['modtrig']
+      self['trig'] = globals.instances[trig['bid']]
+    elseif self['trig'] == nil then
       -- no triggering
       return
     end
-    
-    local trig = eval(self['trig_exp'])['modtrig']
-    local triggerBlock = globals.instances[trig['bid']]
-    self['trig'] = triggerBlock
 
     if sink ~= nil then
       self:logLine('Cla task connected to %s of %d.' % {sink.type, sink.bid})
@@ -334,10 +350,13 @@ function Module.getBlock(globals)
     
      if globals.target.getFamilyPrefix() == '28004x' then
        c.Include:append('f28004x_cla_defines.h')
+       c.ClaInclude:append('f28004x_device.h')
     elseif globals.target.getFamilyPrefix() =='2837x' then
        c.Include:append('f2837xS_cla_defines.h')
+       c.ClaInclude:append('F2837xD_device.h')
     elseif globals.target.getFamilyPrefix() =='2838x' then
        c.Include:append('f2838x_cla_defines.h')
+       c.ClaInclude:append('f2838x_device.h')
     end
 
     local declarations = [[
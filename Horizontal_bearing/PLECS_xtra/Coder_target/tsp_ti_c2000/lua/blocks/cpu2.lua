@@ -147,6 +147,14 @@ function Module.getBlock(globals)
       end
     end
 
+    if cpu2SysCfg['dmaram'] ~= nil then
+      -- the "ram_lnk" configuration of the 2838x places code in GS14
+      if (globals.target.getFamilyPrefix() == '2838x') and (Target.Variables.buildConfig == 2) then
+        return "DMA buffers of the secondary core require the Flash build configuration."
+      end
+      globals.syscfg:setEntry('dmaram', cpu2SysCfg['dmaram'])
+    end
+
     if cpu2SysCfg['dac'] ~= nil then
       for _, dac in ipairs(cpu2SysCfg['dac']) do
         req:add('DAC %s' % {dac.unit}, -1, "Secondary core")
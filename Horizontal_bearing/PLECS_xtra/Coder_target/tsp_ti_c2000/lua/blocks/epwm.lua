@@ -127,6 +127,22 @@ function Module.getBlock(globals)
     self.sync = sync
   end
 
+  -- CLA statements updating the compare value of this module from the
+  -- CPU-to-CLA mailbox, mirrors PLX_PWM_setDutyN()
+  function Epwm:getClaDutyUpdateCode(slot, bank)
+    local code = [[
+    {
+      float duty = EpwmClaDuty[%(dslot)i + %(bank)s];
+      duty = __mminf32(duty, 1.0f);
+      duty = __mmaxf32(duty, 0.0f);
+      float cmp = EpwmClaScaling[%(sslot)i + 2*%(bank)s] + EpwmClaScaling[%(sslot)i + 2*%(bank)s + 1] * duty;
+      cmp = __mminf32(cmp, 65535.0f);
+      EPwm%(unit)iRegs.CMPA.bit.CMPA = (uint16_t)cmp;
+    }
+    ]]
+    return code % {dslot = 2 * slot, sslot = 4 * slot, bank = bank, unit = self.epwm}
+  end
+
   function Epwm:checkMaskParameters(env)
     return "Explicit use of EPWM via target block not supported."
   end
@@ -475,15 +491,12 @@ function Module.getBlock(globals)
       if pil_obj ~= nil then
         c.Declarations:append('bool EpwmForceDisable = false;')
       end
+      c.Declarations:append('PLX_PWM_Group_t EpwmGroup;')
       c.Declarations:append('void PLXHAL_PWM_enableAllOutputs(){')
       if pil_obj ~= nil then
         c.Declarations:append('  if(!EpwmForceDisable){')
       end
-      for _, bid in pairs(static.instances) do
-        local epwm = globals.instances[bid]
-        c.Declarations:append('    PLX_PWM_enableOut(EpwmHandles[%i]);' %
-                                  epwm:getParameter('instance'))
-      end
+      c.Declarations:append('    PLX_PWM_enableGroupOut(&EpwmGroup);')
       if pil_obj ~= nil then
         c.Declarations:append('  }')
       end
@@ -510,6 +523,16 @@ function Module.getBlock(globals)
       end
     end
 
+    if powerstage_obj == nil then
+      -- outputs are enabled in a single pass over all modules
+      c.PreInitCode:append('PLX_PWM_initGroup(&EpwmGroup);')
+      for _, bid in pairs(static.instances) do
+        local epwm = globals.instances[bid]
+        c.PreInitCode:append('PLX_PWM_addToGroup(&EpwmGroup, EpwmHandles[%i]);' %
+                                 epwm:getParameter('instance'))
+      end
+    end
+
     c.TimerSyncCode:append(globals.target.getEpwmTimersSyncCode())
 
     static.finalized = true
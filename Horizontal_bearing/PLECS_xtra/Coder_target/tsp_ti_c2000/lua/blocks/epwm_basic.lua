@@ -22,9 +22,18 @@ local static = {
   numInstances = 0,
   numChannels = 0,
   instances = {},
+  -- CLA duty update (mailbox slots, double-buffer groups, next free task)
+  numClaSlots = 0,
+  claHandles = {},
+  numClaGroups = 0,
+  nextClaTask = 7,
+  claSequence = nil,
   finalized = nil
 }
 
+-- CpuToCla1MsgRAM: 2x2 floats per slot plus one bank index per group
+local CLA_MSGRAM_WORDS = 128
+
 function Module.getBlock(globals)
 
   local EpwmBasic = require('blocks.block').getBlock(globals)
@@ -43,6 +52,34 @@ function Module.getBlock(globals)
       return "Enable port 'en' not supported by this target (%s)." %
                  {Target.Name}
     end
+
+    if Block.Mask.claduty == 2 then
+      if globals.target.getTargetParameters()['clas'] == nil then
+        return "CLA duty update not supported by this target (%s)." %
+                   {Target.Name}
+      end
+      if Block.Mask.sequence == 3 then
+        return "CLA duty update cannot be combined with the sequence port 'seq'."
+      end
+      if (Block.Mask.modulator ~= nil) and (Block.Mask.modulator ~= 1) then
+        return "CLA duty update requires the 'Duty cycle' modulator."
+      end
+    end
+
+    if (Block.Mask.modulator == 2) and (#Block.Mask.pwm ~= 3) then
+      return "The space vector modulator requires three PWM generators."
+    end
+
+    if Block.Mask.modulator == 3 then
+      -- PLX_SVM_setMultiLevelDutyN() holds one phase worth of duties on the stack
+      local modules = Block.Mask.level_modules
+      if (modules < 2) or (modules > 4) or (math.floor(modules) ~= modules) then
+        return "'PWM generators per phase' must be an integer between 2 and 4."
+      end
+      if #Block.Mask.pwm % modules ~= 0 then
+        return "The number of PWM generators must be a multiple of 'PWM generators per phase'."
+      end
+    end
   end
 
   function EpwmBasic:getDirectFeedthroughCode()
@@ -53,7 +90,8 @@ function Module.getBlock(globals)
 
     table.insert(static.instances, self.bid)
 
-    local dim = #Block.InputSignal[1]
+    -- the input carries one duty per PWM unless a modulator is selected
+    local dim = #Block.Mask.pwm
     if dim == 0 then
       return "At least one PWM must be configured."
     end
@@ -186,6 +224,15 @@ function Module.getBlock(globals)
     end
 
     self.channels = {}
+    -- duties of all legs are written with a single PLXHAL_PWM_setDutyN() call,
+    -- unless an enable port requires skipping the duty of passive legs
+    local dutyVarName = "epwm%iDuty" % {static.numChannels}
+    local dutyPerChannel = (Block.Mask.show_enable == 2) and
+                               (Block.Mask.modulator ~= 2) and
+                               (Block.Mask.modulator ~= 3) and
+                               (Block.Mask.claduty ~= 2)
+    local firstInstance
+    local dutyGroupContiguous = true
     for i = 1, dim do
       local pwm = Block.Mask.pwm[i]
 
@@ -222,6 +269,11 @@ function Module.getBlock(globals)
                        {static.numChannels, pwm})
 
       self.channels[static.numChannels] = epwm
+      if firstInstance == nil then
+        firstInstance = epwm:getParameter('instance')
+      elseif epwm:getParameter('instance') ~= firstInstance + i - 1 then
+        dutyGroupContiguous = false
+      end
 
       if Block.Mask.show_enable == 2 then
         OutputCode:append("if((%s) == 0)\n" % {Block.InputSignal[3][i]})
@@ -233,7 +285,12 @@ function Module.getBlock(globals)
       end
 
       OutputCode:append("{\n")
-      if Block.Mask.sequence == 3 then
+      if (Block.Mask.sequence == 3) and (Block.Mask.claduty == 2) then
+        -- slots are allocated below, in channel order
+        static.claSequence = true
+        OutputCode:append("  PLXHAL_PWM_setClaSequence(%i, %s);" %
+                              {static.numClaSlots + i - 1, Block.InputSignal[2][i]})
+      elseif Block.Mask.sequence == 3 then
         OutputCode:append("  PLXHAL_PWM_setSequence(%i, %s);" %
                               {epwm:getParameter('instance'), Block.InputSignal[2][i]})
         if Block.Mask.show_enable == 2 then
@@ -254,13 +311,114 @@ function Module.getBlock(globals)
         OutputCode:append("  PLXHAL_PWM_setScaledDeadTimeCounts(%i, %s, %i);" %
                               {epwm:getParameter('instance'), Block.InputSignal[4][i], dt})
       end
-      OutputCode:append("  PLXHAL_PWM_setDuty(%i, %s);" %
-                            {epwm:getParameter('instance'), Block.InputSignal[1][i]})
+      if dutyPerChannel then
+        OutputCode:append("  PLXHAL_PWM_setDuty(%i, %s);" %
+                              {epwm:getParameter('instance'), Block.InputSignal[1][i]})
+      end
       OutputCode:append("}\n")
 
       static.numChannels = static.numChannels + 1
     end
 
+    -- The SVM, multi-level and CLA paths update all legs of the block and
+    -- also write the compare values of passive legs. These have no effect
+    -- on the outputs, which are held by the continuous software force until
+    -- the leg is set to operational again.
+    if Block.Mask.modulator == 2 then
+      if not dutyGroupContiguous then
+        return "The space vector modulator requires consecutive PWM instances."
+      end
+      -- alpha/beta reference, the three leg duties are written by PLX_SVM_setDuties()
+      static.svm = true
+      OutputCode:append("PLXHAL_PWM_setSvm(%i, %i, %s, %s);" %
+                            {firstInstance, Block.Mask.svm_mode - 1,
+                             Block.InputSignal[1][1], Block.InputSignal[1][2]})
+    elseif Block.Mask.modulator == 3 then
+      if not dutyGroupContiguous then
+        return "The multi-level modulator requires consecutive PWM instances."
+      end
+      -- one reference per phase, the modules of each phase are consecutive
+      static.multiLevel = true
+      local modules = Block.Mask.level_modules
+      local numPhases = math.floor(dim / modules)
+      local refVarName = "epwm%iRef" % {self.first_channel}
+      OutputCode:append("{\n")
+      OutputCode:append("  float %s[%i];" % {refVarName, numPhases})
+      for i = 1, numPhases do
+        OutputCode:append("  %s[%i] = %s;" %
+                              {refVarName, i - 1, Block.InputSignal[1][i]})
+      end
+      OutputCode:append("  PLXHAL_PWM_setMultiLevelRefN(%i, %s, %i, %i);" %
+                            {firstInstance, refVarName, numPhases, modules})
+      OutputCode:append("}\n")
+    elseif Block.Mask.claduty == 2 then
+      -- duties are posted to the CLA, which writes the compare registers
+      -- from a task triggered by the PWM interrupt of the first module
+      self.cla_group = static.numClaGroups
+      self.cla_first_slot = static.numClaSlots
+      static.numClaGroups = static.numClaGroups + 1
+      static.numClaSlots = static.numClaSlots + dim
+      -- per slot and bank: duty, offset and scale (2 words each)
+      if 12 * static.numClaSlots + static.numClaGroups > CLA_MSGRAM_WORDS then
+        return "Too many PWM generators with CLA duty update."
+      end
+      if static.nextClaTask < 1 then
+        return "No CLA task available for duty update."
+      end
+
+      local claCode = StringList:new()
+      claCode:append("uint16_t bank = EpwmClaBank[%i];" % {self.cla_group})
+      for i = 1, dim do
+        local epwm = self.channels[self.first_channel + i - 1]
+        claCode:append(epwm:getClaDutyUpdateCode(self.cla_first_slot + i - 1, 'bank'))
+        table.insert(static.claHandles, epwm:getParameter('instance'))
+      end
+      -- the task is triggered by the first module only, re-arm its interrupt
+      claCode:append("EPwm%iRegs.ETCLR.bit.INT = 1;" % {self.first_unit})
+
+      local claDeclarations = StringList:new()
+      claDeclarations:append('extern volatile float EpwmClaDuty[];')
+      claDeclarations:append('extern volatile float EpwmClaScaling[];')
+      claDeclarations:append('extern volatile uint16_t EpwmClaBank[];')
+
+      local cla = self:makeBlock("cla")
+      cla:createImplicit({
+        task = static.nextClaTask,
+        trig = self,
+        declarations = claDeclarations,
+        code = claCode
+      }, Require)
+      static.nextClaTask = static.nextClaTask - 1
+
+      OutputCode:append("{\n")
+      OutputCode:append("  float %s[%i];" % {dutyVarName, dim})
+      for i = 1, dim do
+        OutputCode:append("  %s[%i] = %s;" %
+                              {dutyVarName, i - 1, Block.InputSignal[1][i]})
+      end
+      OutputCode:append("  PLXHAL_PWM_setClaDutyN(%i, %i, %s, %i);" %
+                            {self.cla_group, self.cla_first_slot, dutyVarName, dim})
+      OutputCode:append("}\n")
+    elseif dutyPerChannel then
+      -- written in the enabled branch of each channel above
+    elseif dutyGroupContiguous then
+      OutputCode:append("{\n")
+      OutputCode:append("  float %s[%i];" % {dutyVarName, dim})
+      for i = 1, dim do
+        OutputCode:append("  %s[%i] = %s;" %
+                              {dutyVarName, i - 1, Block.InputSignal[1][i]})
+      end
+      OutputCode:append("  PLXHAL_PWM_setDutyN(%i, %s, %i);" %
+                            {firstInstance, dutyVarName, dim})
+      OutputCode:append("}\n")
+    else
+      for i = 1, dim do
+        local epwm = self.channels[self.first_channel + i - 1]
+        OutputCode:append("PLXHAL_PWM_setDuty(%i, %s);" %
+                              {epwm:getParameter('instance'), Block.InputSignal[1][i]})
+      end
+    end
+
     if (self.int_loc == '') then
       OutputSignal:append("{}")
     else
@@ -366,17 +524,20 @@ function Module.getBlock(globals)
       end
       if sink.type == 'modtrig' then
         local b = globals.instances[sink.bid]
-        local isr
         if b:getType() == 'tasktrigger' then
-          isr = '%s_baseTaskInterrupt' % {Target.Variables.BASE_NAME}
+          self.isr = '%s_baseTaskInterrupt' % {Target.Variables.BASE_NAME}
           self:logLine('Providing Task trigger')
         else
-          -- CLA trigger
+          -- CLA trigger, every carrier period unless a task trigger event is set
+          if self.int_loc == '' then
+            self.int_loc = 'z'
+            self.int_prd = 1
+          end
         end
         self.channels[self.first_channel]:configureInterruptEvents({
           int_prd = self.int_prd,
           int_loc = self.int_loc,
-          isr = isr
+          isr = self.isr
         })
       end
       if sink.type == 'adctrig' then
@@ -465,6 +626,9 @@ function Module.getBlock(globals)
     end
 
     c.Include:append('plx_pwm.h')
+    if (static.svm ~= nil) or (static.multiLevel ~= nil) then
+      c.Include:append('plx_svm.h')
+    end
 
     c.Declarations:append('extern PLX_PWM_Handle_t EpwmHandles[];')
 
@@ -474,6 +638,28 @@ function Module.getBlock(globals)
         '  PLX_PWM_setPwmDuty(EpwmHandles[aHandle], aDuty);')
     c.Declarations:append('}')
 
+    c.Declarations:append(
+        'void PLXHAL_PWM_setDutyN(uint16_t aFirstHandle, const float *aDuties, uint16_t aNum){')
+    c.Declarations:append(
+        '  PLX_PWM_setDutyN(&EpwmHandles[aFirstHandle], aDuties, aNum);')
+    c.Declarations:append('}')
+
+    if static.svm ~= nil then
+      c.Declarations:append(
+          'void PLXHAL_PWM_setSvm(uint16_t aFirstHandle, uint16_t aMode, float aAlpha, float aBeta){')
+      c.Declarations:append(
+          '  PLX_SVM_setDuties(&EpwmHandles[aFirstHandle], (PLX_SVM_Mode_t)aMode, aAlpha, aBeta);')
+      c.Declarations:append('}')
+    end
+
+    if static.multiLevel ~= nil then
+      c.Declarations:append(
+          'void PLXHAL_PWM_setMultiLevelRefN(uint16_t aFirstHandle, const float *aRefs, uint16_t aNumPhases, uint16_t aModulesPerPhase){')
+      c.Declarations:append(
+          '  PLX_SVM_setMultiLevelDutyN(&EpwmHandles[aFirstHandle], aRefs, aNumPhases, aModulesPerPhase);')
+      c.Declarations:append('}')
+    end
+
     c.Declarations:append('void PLXHAL_PWM_setToPassive(uint16_t aChannel){')
     c.Declarations:append(
         '  PLX_PWM_setOutToPassive(EpwmHandles[aChannel]);')
@@ -513,6 +699,105 @@ function Module.getBlock(globals)
     ]==]
     c.Declarations:append(setDeadTimeCode)
 
+    if static.numClaSlots > 0 then
+      local claMailbox = [==[
+      #pragma DATA_SECTION(EpwmClaDuty, "CpuToCla1MsgRAM")
+      volatile float EpwmClaDuty[%(num_duty)i];
+      #pragma DATA_SECTION(EpwmClaScaling, "CpuToCla1MsgRAM")
+      volatile float EpwmClaScaling[%(num_scaling)i];
+      #pragma DATA_SECTION(EpwmClaBank, "CpuToCla1MsgRAM")
+      volatile uint16_t EpwmClaBank[%(num_groups)i];
+
+      // PWM handle of each slot
+      static const uint16_t EpwmClaHandle[%(num_slots)i] = {%(handles)s};
+
+      // banks still holding the scaling of a previous sequence
+      static uint16_t EpwmClaScalingStale[%(num_slots)i];
+
+      static void EpwmPostClaScaling(uint16_t aSlot, uint16_t aBank){
+        float offset, scale;
+        PLX_PWM_getDutyScaling(EpwmHandles[EpwmClaHandle[aSlot]], &offset, &scale);
+        EpwmClaScaling[4*aSlot + 2*aBank] = offset;
+        EpwmClaScaling[4*aSlot + 2*aBank + 1] = scale;
+      }
+
+      // fills the idle bank, then hands it to the CLA
+      void PLXHAL_PWM_setClaDutyN(uint16_t aGroup, uint16_t aFirstSlot, const float *aDuties, uint16_t aNum){
+        uint16_t bank = EpwmClaBank[aGroup] ^ 1;
+        uint16_t i;
+        for(i=0; i<aNum; i++){
+          uint16_t slot = aFirstSlot + i;
+          EpwmClaDuty[2*slot + bank] = aDuties[i];
+          if(EpwmClaScalingStale[slot] != 0){
+            EpwmPostClaScaling(slot, bank);
+            EpwmClaScalingStale[slot]--;
+          }
+        }
+        EpwmClaBank[aGroup] = bank;
+      }
+      ]==]
+      c.Declarations:append(claMailbox % {
+        num_duty = 2 * static.numClaSlots,
+        num_scaling = 4 * static.numClaSlots,
+        num_slots = static.numClaSlots,
+        num_groups = static.numClaGroups,
+        handles = table.concat(static.claHandles, ', ')
+      })
+      if static.claSequence ~= nil then
+        -- the carrier is fixed, only a sequence change alters the scaling
+        c.Declarations:append([[
+        static uint16_t EpwmClaSequence[%(num_slots)i];
+
+        void PLXHAL_PWM_setClaSequence(uint16_t aSlot, uint16_t aSequence){
+          if(aSequence != EpwmClaSequence[aSlot]){
+            EpwmClaSequence[aSlot] = aSequence;
+            PLXHAL_PWM_setSequence(EpwmClaHandle[aSlot], aSequence);
+            EpwmClaScalingStale[aSlot] = 2;
+          }
+        }
+        ]] % {num_slots = static.numClaSlots})
+      end
+      c.PreInitCode:append([[
+      {
+        uint16_t i;
+        for(i=0; i<%(num_duty)i; i++){
+          EpwmClaDuty[i] = 0.0;
+        }
+        for(i=0; i<%(num_groups)i; i++){
+          EpwmClaBank[i] = 0;
+        }
+        for(i=0; i<%(num_slots)i; i++){
+          EpwmClaScalingStale[i] = 0;
+        }
+      }
+      ]] % {
+        num_duty = 2 * static.numClaSlots,
+        num_groups = static.numClaGroups,
+        num_slots = static.numClaSlots
+      })
+      if static.claSequence ~= nil then
+        -- no valid sequence, the first setting is always applied
+        c.PreInitCode:append([[
+        {
+          uint16_t i;
+          for(i=0; i<%(num_slots)i; i++){
+            EpwmClaSequence[i] = 0xFFFF;
+          }
+        }
+        ]] % {num_slots = static.numClaSlots})
+      end
+      -- both banks, the CLA task may run before the first post
+      c.PostInitCode:append([[
+      {
+        uint16_t i;
+        for(i=0; i<%(num_slots)i; i++){
+          EpwmPostClaScaling(i, 0);
+          EpwmPostClaScaling(i, 1);
+        }
+      }
+      ]] % {num_slots = static.numClaSlots})
+    end
+
     for _, bid in pairs(static.instances) do
       local epwm = globals.instances[bid]
       local c = epwm:finalizeThis(c)
@@ -203,6 +203,10 @@ function Module.getBlock(globals)
       end
     end
     
+    -- type-4 modules stage all parameters and commit them with a single
+    -- one-shot global load per step
+    self.global_load = (globals.target.getTargetParameters()['epwms']['type'] == 4)
+
     self.channels = {}
     for i = 1, num_pwm do
       local pwm = pwm_selected[i]
@@ -254,6 +258,12 @@ function Module.getBlock(globals)
       static.numChannels = static.numChannels + 1
     end
 
+    if self.global_load then
+      -- first leg acts as global load master for the whole block
+      self.gld_master = self.channels[static.numChannels - num_pwm]:getParameter('instance')
+      OutputCode:append("PLXHAL_PWM_commitGlobalLoad(%i);" % {self.gld_master})
+    end
+
     if (self.int_loc == '') then
       OutputSignal:append("{}")
     else
@@ -492,6 +502,13 @@ function Module.getBlock(globals)
   end
 
   function EpwmVar:finalizeThis(c)
+    if self.global_load then
+      for _, epwm in pairs(self.channels) do
+        c.PostInitCode:append("PLX_PWM_enableGlobalLoad(EpwmHandles[%i], EpwmHandles[%i]);" %
+                                  {epwm:getParameter('instance'), self.gld_master})
+      end
+    end
+
     local isModTrigger = false
     if self['modtrig'] ~= nil then
       for _, b in ipairs(self['modtrig']) do
@@ -546,6 +563,12 @@ function Module.getBlock(globals)
     ]==]
     c.Declarations:append(code)
 
+    if globals.target.getTargetParameters()['epwms']['type'] == 4 then
+      c.Declarations:append('void PLXHAL_PWM_commitGlobalLoad(uint16_t aChannel){')
+      c.Declarations:append('  PLX_PWM_commitGlobalLoad(EpwmHandles[aChannel]);')
+      c.Declarations:append('}')
+    end
+
     for _, bid in pairs(static.instances) do
       local epwm = globals.instances[bid]
       local c = epwm:finalizeThis(c)
@@ -254,7 +254,64 @@ function Module.getBlock(globals)
       f.Declarations:append('PIL_CONST_DEF(uint32_t, BaudRate, %i);' % {sciBaud})
 
       -- generate UART polling code
-      local code = [[
+      local code
+      if sciPinset == nil then
+        -- FIFO interrupts fill/drain RAM rings, background only moves blocks
+        code = [[
+      #define SCI_BUF_LEN 128
+      uint16_t SciRxBuf[SCI_BUF_LEN];
+      uint16_t SciTxBuf[SCI_BUF_LEN];
+
+      interrupt void %(base)s_sciRxInterrupt(void)
+      {
+        PLX_SCI_rxIsr(SciHandle);
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP9;
+      }
+
+      interrupt void %(base)s_sciTxInterrupt(void)
+      {
+        PLX_SCI_txIsr(SciHandle);
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP9;
+      }
+
+      static void SciPoll(PIL_Handle_t aHandle)
+      {
+        uint16_t buf[16];
+        uint16_t i, n;
+
+        do
+        {
+          n = PLX_SCI_read(SciHandle, buf, 16);
+          for(i=0; i<n; i++)
+          {
+            PIL_SERIAL_IN(aHandle, (int16)buf[i]);
+          }
+        } while(n == 16);
+
+        // PIL hands out one character at a time, move them while there is room
+        static int16_t ch;
+        static bool chPending = false;
+        for(;;)
+        {
+          if(!chPending)
+          {
+            if(!PIL_SERIAL_OUT(aHandle, &ch))
+            {
+              break;
+            }
+            chPending = true;
+          }
+          uint16_t c = (uint16_t)ch;
+          if(PLX_SCI_write(SciHandle, &c, 1) == 0)
+          {
+            break;
+          }
+          chPending = false;
+        }
+      }
+      ]] % {base = Target.Variables.BASE_NAME}
+      else
+        code = [[
       static void SciPoll(PIL_Handle_t aHandle)
       {
 	    if(PLX_SCI_breakOccurred(SciHandle)){
@@ -276,6 +333,7 @@ function Module.getBlock(globals)
 	    }
       }
       ]]
+      end
       f.Declarations:append(code)
 
       -- initialize SCI object
@@ -290,8 +348,27 @@ function Module.getBlock(globals)
           unit = 'PLX_SCI_SCI_%s' % {unit},
           clock = globals.target.getLowSpeedClock()
          })
+        f.PreInitCode:append('PLX_SCI_setupBuffers(SciHandle, SciRxBuf, SCI_BUF_LEN, SciTxBuf, SCI_BUF_LEN);')
       end
       f.PreInitCode:append('(void)PLX_SCI_setupPort(SciHandle, %i);' % {sciBaud})
+      if sciPinset == nil then
+        local isrConfigCode = [[
+        EALLOW;
+        PieVectTable.SCI%(unit)s_RX_INT = &%(base)s_sciRxInterrupt;
+        PieVectTable.SCI%(unit)s_TX_INT = &%(base)s_sciTxInterrupt;
+        EDIS;
+        PieCtrlRegs.PIEIER9.bit.INTx%(rx)i = 1;
+        PieCtrlRegs.PIEIER9.bit.INTx%(tx)i = 1;
+        ]]
+        local pie = 1 + 2*(string.byte(unit) - string.byte('A')) -- SCIA: INTx1/2, SCIB: INTx3/4
+        f.PreInitCode:append(isrConfigCode % {
+          unit = unit,
+          base = Target.Variables.BASE_NAME,
+          rx = pie,
+          tx = pie + 1
+        })
+        f.InterruptEnableCode:append('IER |= M_INT9;')
+      end
     end
 
     -- configure PIL framework
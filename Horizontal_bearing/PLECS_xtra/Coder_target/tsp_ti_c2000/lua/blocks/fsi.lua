@@ -0,0 +1,247 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0, instances = {}, finalized = nil}
+
+function Module.getBlock(globals)
+
+  local Fsi = require('blocks.block').getBlock(globals)
+  Fsi["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function Fsi:checkMaskParameters(env)
+  end
+
+  -- gpio: {D0, CLK} (one lane) or {D0, D1, CLK} (two lanes)
+  function Fsi:createImplicit(fsi, params, req)
+    local fsis = globals.target.getTargetParameters()['fsis']
+    if fsis == nil then
+      return 'This chip does not have a fast serial interface (FSI).'
+    end
+
+    self.rx = params.rx
+    self.dir = self.rx and 'RX' or 'TX'
+    local numUnits = self.rx and fsis.num_rx or fsis.num_tx
+    if fsi >= numUnits then
+      return 'FSI%s %s not available on this chip.' % {self.dir, string.char(65 + fsi)}
+    end
+    self.fsi_letter = string.char(65 + fsi)
+    table.insert(static.instances, self.bid)
+    req:add('FSI%s %s' % {self.dir, self.fsi_letter})
+
+    self:logLine('FSI%s %s implicitly created.' % {self.dir, self.fsi_letter})
+
+    self.num_words = params.num_words
+    if (self.num_words < 1) or (self.num_words > 16) or
+        (self.num_words ~= math.floor(self.num_words)) then
+      return 'Words per frame must be an integer between 1 and 16.'
+    end
+
+    local signals
+    if #params.gpio == 2 then
+      self.num_lanes = 1
+      signals = {'D0', 'CLK'}
+    elseif #params.gpio == 3 then
+      self.num_lanes = 2
+      signals = {'D0', 'D1', 'CLK'}
+    else
+      return 'Invalid GPIO configuration.'
+    end
+    local pinconf = {}
+    for i, p in ipairs(params.gpio) do
+      pinconf[i] = 'GPIO_%i_FSI%s%s_%s' % {p, self.dir, self.fsi_letter, signals[i]}
+      if not globals.target.validateAlternateFunction(pinconf[i]) then
+        return 'Invalid GPIO configured for FSI block.'
+      end
+    end
+    globals.syscfg:addEntry('fsi', {
+      unit = self.fsi_letter,
+      rx = self.rx,
+      pins = params.gpio,
+      pinconf = pinconf
+    })
+
+    local sysClk = Target.Variables.sysClkMHz * 1e6
+    self.tag = params.tag or 0
+    self.ping_period = 0
+    self.ping_timeout = 0
+    if self.rx then
+      if (params.ping_timeout ~= nil) and (params.ping_timeout > 0) then
+        self.ping_timeout = math.floor(params.ping_timeout * sysClk + 0.5)
+      end
+    else
+      if (params.clk <= 0) or (params.clk > fsis.max_clk) then
+        return 'FSI clock must be positive and not exceed %i MHz.' % {fsis.max_clk / 1e6}
+      end
+      self.prescale = math.ceil(sysClk / (2 * params.clk))
+      if self.prescale > 255 then
+        return 'FSI clock too low.'
+      end
+      local actualClk = sysClk / (2 * self.prescale)
+      if actualClk ~= params.clk then
+        self:logLine('FSI%s %s clock set to %f Hz (desired %f Hz).' %
+                       {self.dir, self.fsi_letter, actualClk, params.clk})
+      end
+      if (params.ping_period ~= nil) and (params.ping_period > 0) then
+        self.ping_period = math.floor(params.ping_period * sysClk + 0.5)
+      end
+    end
+    if (self.ping_period > 0xFFFFFFFF) or (self.ping_timeout > 0xFFFFFFFF) then
+      return 'Ping period/timeout too long.'
+    end
+
+    if params.dma_channel ~= nil then
+      -- received frames copied by DMA, see PLX_FSI_setupDmaRxFrames()
+      if globals.target.getTargetParameters()['dmas'] == nil then
+        return 'This chip does not support DMA transfers of FSI frames.'
+      end
+      local n = self.num_words
+      if (n ~= 1) and (n ~= 2) and (n ~= 4) and (n ~= 8) and (n ~= 16) then
+        return 'DMA transfers require 1, 2, 4, 8 or 16 words per frame.'
+      end
+      self.dma_channel = params.dma_channel
+      req:add('DMA', self.dma_channel)
+      static.dma = true
+    end
+  end
+
+  function Fsi:getDirectFeedthroughCode()
+    return "Explicit use of FSI via target block not supported."
+  end
+
+  function Fsi:getNonDirectFeedthroughCode()
+    return "Explicit use of FSI via target block not supported."
+  end
+
+  function Fsi:finalizeThis(c)
+    c.PreInitCode:append(" // configure FSI%s-%s" % {self.dir, self.fsi_letter})
+    c.PreInitCode:append("{")
+    c.PreInitCode:append("  PLX_FSI_Params_t params;")
+    c.PreInitCode:append("  PLX_FSI_setDefaultParams(&params);")
+    c.PreInitCode:append("  params.numWords = %i;" % {self.num_words})
+    c.PreInitCode:append("  params.numLanes = %i;" % {self.num_lanes})
+    c.PreInitCode:append("  params.tag = %i;" % {self.tag})
+    if self.rx then
+      c.PreInitCode:append("  params.pingTimeout = %iUL;" % {self.ping_timeout})
+    else
+      c.PreInitCode:append("  params.prescale = %i;" % {self.prescale})
+      c.PreInitCode:append("  params.pingPeriod = %iUL;" % {self.ping_period})
+    end
+    c.PreInitCode:append(
+        "  PLX_FSI_configure(FsiHandles[%i], PLX_FSI_%s_%s, &params);" %
+            {self.instance, self.dir, self.fsi_letter})
+    c.PreInitCode:append("}")
+
+    if self.dma_channel ~= nil then
+      local rxFrames = 'FsiDma%iRxFrames' % {self.instance}
+      c.Declarations:append('#pragma DATA_SECTION(%s, "dmaram")' % {rxFrames})
+      c.Declarations:append('uint16_t %s[%i];' % {rxFrames, 2 * self.num_words})
+      c.PreInitCode:append(
+          " // receive frames of %i words with DMA CH%i" %
+              {self.num_words, self.dma_channel})
+      c.PreInitCode:append(
+          "PLX_FSI_setupDmaRxFrames(FsiHandles[%i], %i, %s);" %
+              {self.instance, self.dma_channel, rxFrames})
+    end
+    return c
+  end
+
+  function Fsi:finalize(c)
+    if static.finalized ~= nil then
+      return {}
+    end
+
+    c.Include:append('plx_fsi.h')
+    c.Declarations:append('PLX_FSI_Handle_t FsiHandles[%i];' %
+                              {static.numInstances})
+    c.Declarations:append('PLX_FSI_Obj_t FsiObj[%i];' % {static.numInstances})
+
+    c.Declarations:append(
+        'bool PLXHAL_FSI_putFrame(int16_t aChannel, const uint16_t *aData){')
+    c.Declarations:append(
+        '  return PLX_FSI_putFrame(FsiHandles[aChannel], aData);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'bool PLXHAL_FSI_getFrame(int16_t aChannel, uint16_t *aData){')
+    c.Declarations:append(
+        '  return PLX_FSI_getFrame(FsiHandles[aChannel], aData);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'void PLXHAL_FSI_updateStatus(int16_t aChannel){')
+    c.Declarations:append(
+        '  PLX_FSI_updateStatus(FsiHandles[aChannel]);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'bool PLXHAL_FSI_isLinkUp(int16_t aChannel){')
+    c.Declarations:append(
+        '  return PLX_FSI_isLinkUp(FsiHandles[aChannel]);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'uint32_t PLXHAL_FSI_getErrorCount(int16_t aChannel){')
+    c.Declarations:append(
+        '  PLX_FSI_Handle_t h = FsiHandles[aChannel];')
+    c.Declarations:append(
+        '  return PLX_FSI_getCrcErrorCount(h) + PLX_FSI_getFrameErrorCount(h)')
+    c.Declarations:append(
+        '         + PLX_FSI_getOverrunCount(h) + PLX_FSI_getLostFrameCount(h);')
+    c.Declarations:append('}')
+
+    if static.dma ~= nil then
+      c.Declarations:append(
+          'bool PLXHAL_FSI_getDmaRxFrame(int16_t aChannel, uint16_t **aFrame){')
+      c.Declarations:append(
+          '  return PLX_FSI_getDmaRxFrame(FsiHandles[aChannel], aFrame);')
+      c.Declarations:append('}')
+
+      c.Include:append('plx_dma.h')
+      c.PreInitCode:append('PLX_DMA_sinit();')
+    end
+
+    local code = [[
+    {
+      PLX_FSI_sinit();
+      int i;
+      for(i=0; i<%d; i++)
+      {
+        FsiHandles[i] = PLX_FSI_init(&FsiObj[i], sizeof(FsiObj[i]));
+      }
+    }]]
+    c.PreInitCode:append(code % {static.numInstances})
+
+    for _, bid in pairs(static.instances) do
+      local fsi = globals.instances[bid]
+      local c = fsi:finalizeThis(c)
+      if type(c) == 'string' then
+        return c
+      end
+    end
+
+    static.finalized = true
+    return c
+  end
+
+  return Fsi
+end
+
+return Module
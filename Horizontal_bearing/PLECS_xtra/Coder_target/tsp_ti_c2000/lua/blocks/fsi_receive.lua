@@ -0,0 +1,113 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0}
+
+function Module.getBlock(globals)
+
+  local FsiReceive = require('blocks.block').getBlock(globals)
+  FsiReceive["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function FsiReceive:checkMaskParameters(env)
+  end
+
+  function FsiReceive:getDirectFeedthroughCode()
+    local Require = ResourceList:new()
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+
+    local dim = Block.Mask.dim
+
+    local dmaChannel
+    if (Block.Mask.dma ~= nil) and (Block.Mask.dma == 2) then
+      dmaChannel = Block.Mask.dmach
+    end
+
+    self.fsi_obj = self:makeBlock('fsi')
+    local error = self.fsi_obj:createImplicit(Block.Mask.fsi - 1, {
+      rx = true,
+      num_words = dim,
+      gpio = Block.Mask.pinset,
+      ping_timeout = Block.Mask.timeout,
+      dma_channel = dmaChannel
+    }, Require)
+    if error ~= nil then
+      return error
+    end
+
+    self.fsi_instance = self.fsi_obj:getParameter('instance')
+    local prefix = 'FsiRx%i' % {self.fsi_instance}
+
+    if dmaChannel ~= nil then
+      OutputCode:append("static uint16_t *%sFrame;\n" % {prefix})
+    else
+      OutputCode:append("static uint16_t %sFrame[%i];\n" % {prefix, dim})
+    end
+    OutputCode:append("static bool %sDataReady = false;\n" % {prefix})
+    OutputCode:append("static bool %sLinkUp = false;\n" % {prefix})
+    OutputCode:append("static uint32_t %sErrors = 0;\n" % {prefix})
+    OutputCode:append("{\n")
+    if dmaChannel ~= nil then
+      OutputCode:append("  %sDataReady = PLXHAL_FSI_getDmaRxFrame(%i, &%sFrame);\n" %
+                            {prefix, self.fsi_instance, prefix})
+    else
+      OutputCode:append("  %sDataReady = PLXHAL_FSI_getFrame(%i, %sFrame);\n" %
+                            {prefix, self.fsi_instance, prefix})
+    end
+    OutputCode:append("  PLXHAL_FSI_updateStatus(%i);\n" % {self.fsi_instance})
+    OutputCode:append("  %sLinkUp = PLXHAL_FSI_isLinkUp(%i);\n" %
+                          {prefix, self.fsi_instance})
+    OutputCode:append("  // CRC, frame, overrun and lost frame errors since startup\n")
+    OutputCode:append("  %sErrors = PLXHAL_FSI_getErrorCount(%i);\n" %
+                          {prefix, self.fsi_instance})
+    OutputCode:append("}\n")
+
+    OutputSignal[1] = {}
+    for i = 1, dim do
+      OutputSignal[1][i] = "%sFrame[%i]" % {prefix, i - 1}
+    end
+    OutputSignal[2] = {}
+    OutputSignal[2][1] = "%sDataReady" % {prefix}
+    OutputSignal[3] = {}
+    OutputSignal[3][1] = "%sLinkUp" % {prefix}
+    OutputSignal[4] = {}
+    OutputSignal[4][1] = "%sErrors" % {prefix}
+
+    return {
+      OutputSignal = OutputSignal,
+      OutputCode = OutputCode,
+      Require = Require,
+      UserData = {bid = FsiReceive:getId()}
+    }
+  end
+
+  function FsiReceive:getNonDirectFeedthroughCode()
+    return {}
+  end
+
+  function FsiReceive:finalize(c)
+    return c
+  end
+
+  return FsiReceive
+end
+
+return Module
@@ -0,0 +1,86 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0}
+
+function Module.getBlock(globals)
+
+  local FsiTransmit = require('blocks.block').getBlock(globals)
+  FsiTransmit["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function FsiTransmit:checkMaskParameters(env)
+  end
+
+  function FsiTransmit:getDirectFeedthroughCode()
+    local Require = ResourceList:new()
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+
+    local dim = Block.Mask.dim
+
+    self.fsi_obj = self:makeBlock('fsi')
+    local error = self.fsi_obj:createImplicit(Block.Mask.fsi - 1, {
+      rx = false,
+      num_words = dim,
+      gpio = Block.Mask.pinset,
+      clk = Block.Mask.clk,
+      tag = Block.Mask.tag,
+      ping_period = Block.Mask.ping
+    }, Require)
+    if error ~= nil then
+      return error
+    end
+
+    self.fsi_instance = self.fsi_obj:getParameter('instance')
+    local prefix = 'FsiTx%i' % {self.fsi_instance}
+
+    -- one frame per step, skipped while the previous frame is still being sent
+    OutputCode:append("static uint16_t %sFrame[%i];\n" % {prefix, dim})
+    OutputCode:append("{\n")
+    for i = 1, dim do
+      OutputCode:append("  %sFrame[%i] = %s;\n" %
+                            {prefix, i - 1, Block.InputSignal[1][i]})
+    end
+    OutputCode:append("  PLXHAL_FSI_putFrame(%i, %sFrame);\n" %
+                          {self.fsi_instance, prefix})
+    OutputCode:append("  PLXHAL_FSI_updateStatus(%i);\n" % {self.fsi_instance})
+    OutputCode:append("}\n")
+
+    return {
+      OutputSignal = OutputSignal,
+      OutputCode = OutputCode,
+      Require = Require,
+      UserData = {bid = FsiTransmit:getId()}
+    }
+  end
+
+  function FsiTransmit:getNonDirectFeedthroughCode()
+    return {}
+  end
+
+  function FsiTransmit:finalize(c)
+    return c
+  end
+
+  return FsiTransmit
+end
+
+return Module
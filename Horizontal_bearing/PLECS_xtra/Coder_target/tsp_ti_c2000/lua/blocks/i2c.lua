@@ -0,0 +1,252 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0, instances = {}, transactions = {}, finalized = nil}
+
+function Module.getBlock(globals)
+
+  local I2c = require('blocks.block').getBlock(globals)
+  I2c["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function I2c:checkMaskParameters(env)
+  end
+
+  function I2c:createImplicit(i2c)
+    self.i2c = i2c
+    self.i2c_letter = string.char(65 + self.i2c)
+    static.instances[self.i2c] = self.bid
+
+    self.is_configured = false
+
+    self:logLine('I2C %s implicitly created.' % {self.i2c_letter})
+  end
+
+  -- params: gpio = {SDA, SCL}, bit_rate, timeout
+  -- all blocks using the same module must agree on the port settings
+  function I2c:configure(params, req)
+    if self.is_configured then
+      if (params.gpio[1] ~= self.gpio[1]) or (params.gpio[2] ~= self.gpio[2]) or
+          (params.bit_rate ~= self.bit_rate) or (params.timeout ~= self.timeout) then
+        return 'Inconsistent port settings for I2C %s.' % {self.i2c_letter}
+      end
+      return
+    end
+
+    local i2cs = globals.target.getTargetParameters()['i2cs']
+    if i2cs == nil then
+      return 'This chip does not support the I2C block.'
+    end
+    if self.i2c >= i2cs.num_units then
+      return 'I2C %s not available on this chip.' % {self.i2c_letter}
+    end
+    req:add('I2C %s' % {self.i2c_letter})
+
+    if #params.gpio ~= 2 then
+      return 'Invalid GPIO configuration.'
+    end
+    self.gpio = params.gpio
+    local pinconf = {}
+    for i, sig in ipairs({'SDA', 'SCL'}) do
+      pinconf[i] = 'GPIO_%i_I2C%s_%s' % {self.gpio[i], self.i2c_letter, sig}
+      if not globals.target.validateAlternateFunction(pinconf[i]) then
+        return 'GPIO%i cannot be used as I2C%s_%s.' % {self.gpio[i], self.i2c_letter, sig}
+      end
+    end
+    globals.syscfg:addEntry('i2c', {
+      unit = self.i2c_letter,
+      pins = self.gpio,
+      pinconf = pinconf
+    })
+
+    -- claim pins
+    globals.target.allocateGpio(self.gpio[1], {}, req)
+    globals.target.allocateGpio(self.gpio[2], {}, req)
+
+    self.bit_rate = params.bit_rate
+    if (self.bit_rate < 10e3) or (self.bit_rate > i2cs.max_bit_rate) then
+      return 'I2C bit rate must be between 10 kHz and %i kHz.' % {i2cs.max_bit_rate / 1e3}
+    end
+
+    -- timeout is measured with the free-running CPU timer 2
+    self.timeout = params.timeout
+    self.timeout_ticks = 0
+    if self.timeout > 0 then
+      self.timeout_ticks = math.floor(self.timeout * globals.target.getTimerClock() + 0.5)
+      if self.timeout_ticks > 0xFFFFFFFF then
+        return 'I2C timeout too long.'
+      end
+    end
+    self.is_configured = true
+  end
+
+  -- returns the transaction index used by PLXHAL_I2C_request() and PLXHAL_I2C_getRxData()
+  -- params: address, tx_data, rx_len
+  function I2c:addTransaction(params)
+    params.i2c_instance = self.instance
+    table.insert(static.transactions, params)
+    return #static.transactions - 1
+  end
+
+  function I2c:getDirectFeedthroughCode()
+    return "Explicit use of I2C via target block not supported."
+  end
+
+  function I2c:getNonDirectFeedthroughCode()
+    return "Explicit use of I2C via target block not supported."
+  end
+
+  function I2c:finalizeThis(c)
+    c.PreInitCode:append(" // configure I2C %s" % {self.i2c_letter})
+    c.PreInitCode:append("{")
+    c.PreInitCode:append("  PLX_I2C_Params_t params;")
+    c.PreInitCode:append("  PLX_I2C_setDefaultParams(&params);")
+    c.PreInitCode:append("  params.bitRate = %iL;" % {math.floor(self.bit_rate)})
+    c.PreInitCode:append("  params.timeoutTicks = %iUL;" % {self.timeout_ticks})
+    c.PreInitCode:append(
+        "  PLX_I2C_configure(I2cHandles[%i], PLX_I2C_I2C_%s, SYSCLK_HZ, &params);" %
+            {self.instance, self.i2c_letter})
+    c.PreInitCode:append("}")
+
+    local isr = '%s_i2c%sInterrupt' % {Target.Variables.BASE_NAME, self.i2c_letter}
+    local itFunction = [[
+    interrupt void %(isr)s(void)
+    {
+      PLX_I2C_isr(I2cHandles[%(instance)i]);
+      PieCtrlRegs.PIEACK.all = PIEACK_GROUP8;
+    }
+    ]]
+    c.Declarations:append("%s\n" % {itFunction % {
+      isr = isr,
+      instance = self.instance
+    }})
+
+    local isrConfigCode = [[
+    EALLOW;
+    PieVectTable.I2C%(unit)s_INT = &%(isr)s;
+    EDIS;
+    PieCtrlRegs.PIEIER8.bit.INTx%(pie)i = 1;
+    ]]
+    c.PreInitCode:append(isrConfigCode % {
+      unit = self.i2c_letter,
+      isr = isr,
+      pie = 1 + 2*self.i2c -- I2CA: INTx1, I2CB: INTx3
+    })
+    c.InterruptEnableCode:append('IER |= M_INT8;')
+
+    -- deferred starts and bus timeouts are handled outside of the control tasks
+    c.BackgroundTaskCodeBlocks:append("PLX_I2C_poll(I2cHandles[%i]);" % {self.instance})
+    return c
+  end
+
+  function I2c:finalize(c)
+    if static.finalized ~= nil then
+      return {}
+    end
+
+    c.Include:append('plx_i2c.h')
+    c.Declarations:append('PLX_I2C_Handle_t I2cHandles[%i];' %
+                              {static.numInstances})
+    c.Declarations:append('PLX_I2C_Obj_t I2cObj[%i];' % {static.numInstances})
+
+    local numTransactions = math.max(1, #static.transactions)
+    local ports = {}
+    for i, t in ipairs(static.transactions) do
+      local k = i - 1
+      if #t.tx_data > 0 then
+        local bytes = {}
+        for j, b in ipairs(t.tx_data) do
+          bytes[j] = '0x%02X' % {b}
+        end
+        c.Declarations:append('static const uint16_t I2cTx%i[%i] = {%s};' %
+                                  {k, #t.tx_data, table.concat(bytes, ', ')})
+      end
+      if t.rx_len > 0 then
+        c.Declarations:append('static uint16_t I2cRx%i[%i];' % {k, t.rx_len})
+      end
+      ports[i] = '%i' % {t.i2c_instance}
+    end
+    if #ports == 0 then
+      ports[1] = '0'
+    end
+    c.Declarations:append('PLX_I2C_Transaction_t I2cTransactions[%i];' % {numTransactions})
+    c.Declarations:append('static const uint16_t I2cTransactionPorts[%i] = {%s};' %
+                              {numTransactions, table.concat(ports, ', ')})
+
+    c.Declarations:append(
+        'bool PLXHAL_I2C_request(uint16_t aTransaction){')
+    c.Declarations:append(
+        '  PLX_I2C_Handle_t h = I2cHandles[I2cTransactionPorts[aTransaction]];')
+    c.Declarations:append(
+        '  return PLX_I2C_queueTransaction(h, &I2cTransactions[aTransaction]);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'bool PLXHAL_I2C_getRxData(uint16_t aTransaction, uint16_t *aData){')
+    c.Declarations:append(
+        '  return PLX_I2C_getRxData(&I2cTransactions[aTransaction], aData);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'uint32_t PLXHAL_I2C_getErrorCount(uint16_t aChannel){')
+    c.Declarations:append(
+        '  PLX_I2C_Handle_t h = I2cHandles[aChannel];')
+    c.Declarations:append(
+        '  return PLX_I2C_getNackCount(h) + PLX_I2C_getArbitrationLostCount(h)')
+    c.Declarations:append(
+        '         + PLX_I2C_getTimeoutCount(h);')
+    c.Declarations:append('}')
+
+    local code = [[
+    {
+      PLX_I2C_sinit();
+      int i;
+      for(i=0; i<%d; i++)
+      {
+        I2cHandles[i] = PLX_I2C_init(&I2cObj[i], sizeof(I2cObj[i]));
+      }
+    }]]
+    c.PreInitCode:append(code % {static.numInstances})
+
+    for _, bid in pairs(static.instances) do
+      local i2c = globals.instances[bid]
+      local c = i2c:finalizeThis(c)
+      if type(c) == 'string' then
+        return c
+      end
+    end
+
+    for i, t in ipairs(static.transactions) do
+      local k = i - 1
+      local tx = (#t.tx_data > 0) and 'I2cTx%i' % {k} or 'NULL'
+      local rx = (t.rx_len > 0) and 'I2cRx%i' % {k} or 'NULL'
+      c.PreInitCode:append(
+          "PLX_I2C_setupTransaction(&I2cTransactions[%i], 0x%02X, %s, %i, %s, %i);" %
+              {k, t.address, tx, #t.tx_data, rx, t.rx_len})
+    end
+
+    static.finalized = true
+    return c
+  end
+
+  return I2c
+end
+
+return Module
@@ -0,0 +1,149 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0}
+
+function Module.getBlock(globals)
+
+  local I2cTransaction = require('blocks.block').getBlock(globals)
+  I2cTransaction["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function I2cTransaction:checkMaskParameters(env)
+    if not env.utils.isPositiveScalar(Block.Mask.baud) then
+      return 'Bit rate must be a positive real scalar value.'
+    end
+    if not env.utils.isNonNegativeIntScalar(Block.Mask.address) or
+        (Block.Mask.address > 0x7F) then
+      return 'Slave address must be an integer between 0 and 127.'
+    end
+    if not env.utils.isNonNegativeIntScalar(Block.Mask.rxlen) then
+      return 'Number of bytes to read must be a non-negative integer.'
+    end
+  end
+
+  function I2cTransaction:getDirectFeedthroughCode()
+    local Require = ResourceList:new()
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+
+    local i2cs = globals.target.getTargetParameters()['i2cs']
+    if i2cs == nil then
+      return 'This chip does not support the I2C block.'
+    end
+
+    local txData = Block.Mask.txdata
+    if type(txData) == 'number' then
+      txData = {txData}
+    end
+    for _, b in ipairs(txData) do
+      if (b < 0) or (b > 255) or (b ~= math.floor(b)) then
+        return 'Data to write must consist of bytes (0 .. 255).'
+      end
+    end
+    local rxLen = Block.Mask.rxlen
+    if (#txData > i2cs.fifo_depth) or (rxLen > i2cs.fifo_depth) then
+      return 'At most %i bytes can be written and read per transaction.' % {i2cs.fifo_depth}
+    end
+    if (#txData == 0) and (rxLen == 0) then
+      return 'Transaction must write or read at least one byte.'
+    end
+
+    self.i2c = Block.Mask.i2c - 1
+
+    -- see if an I2C object has already been created
+    for _, b in ipairs(globals.instances) do
+      if b:getType() == 'i2c' then
+        if b:getParameter('i2c') == self.i2c then
+          self.i2c_obj = b
+          break
+        end
+      end
+    end
+
+    if self.i2c_obj == nil then
+      self.i2c_obj = self:makeBlock('i2c')
+      self.i2c_obj:createImplicit(self.i2c)
+    end
+
+    local error = self.i2c_obj:configure({
+      gpio = Block.Mask.gpio,
+      bit_rate = Block.Mask.baud,
+      timeout = Block.Mask.timeout
+    }, Require)
+    if error ~= nil then
+      return error
+    end
+
+    self.i2c_instance = self.i2c_obj:getParameter('instance')
+    self.transaction = self.i2c_obj:addTransaction({
+      address = Block.Mask.address,
+      tx_data = txData,
+      rx_len = rxLen
+    })
+
+    local prefix = 'I2cTr%i' % {self.transaction}
+    local dataLen = math.max(1, rxLen)
+
+    OutputCode:append("static uint16_t %sData[%i];\n" % {prefix, dataLen})
+    OutputCode:append("static bool %sDone = false;\n" % {prefix})
+    OutputCode:append("static uint32_t %sErrors = 0;\n" % {prefix})
+    OutputCode:append("{\n")
+    OutputCode:append("  // latest completed transaction, never waits for the bus\n")
+    OutputCode:append("  %sDone = PLXHAL_I2C_getRxData(%i, %sData);\n" %
+                          {prefix, self.transaction, prefix})
+    OutputCode:append("  if(%s)\n" % {Block.InputSignal[1][1]})
+    OutputCode:append("  {\n")
+    OutputCode:append("    PLXHAL_I2C_request(%i);\n" % {self.transaction})
+    OutputCode:append("  }\n")
+    OutputCode:append("  // NACK, arbitration lost and timeout events of the bus since startup\n")
+    OutputCode:append("  %sErrors = PLXHAL_I2C_getErrorCount(%i);\n" %
+                          {prefix, self.i2c_instance})
+    OutputCode:append("}\n")
+
+    OutputSignal[1] = {}
+    for i = 1, dataLen do
+      OutputSignal[1][i] = "%sData[%i]" % {prefix, i - 1}
+    end
+    OutputSignal[2] = {}
+    OutputSignal[2][1] = "%sDone" % {prefix}
+    OutputSignal[3] = {}
+    OutputSignal[3][1] = "%sErrors" % {prefix}
+
+    return {
+      OutputSignal = OutputSignal,
+      OutputCode = OutputCode,
+      Require = Require,
+      UserData = {bid = I2cTransaction:getId()}
+    }
+  end
+
+  function I2cTransaction:getNonDirectFeedthroughCode()
+    return {}
+  end
+
+  function I2cTransaction:finalize(c)
+    return c
+  end
+
+  return I2cTransaction
+end
+
+return Module
@@ -44,6 +44,8 @@ function Module.getBlock(globals)
 
   function Can:configure(params, req)
     self.gpio = params.gpio
+    self.rx_fifo = params.rx_fifo -- nil: dedicated rx buffers
+    self.tx_queue = params.tx_queue
 
     rxgpio = 'GPIO_%i_MCAN_RX' % {self.gpio[1]}
     txgpio = 'GPIO_%i_MCAN_TX' % {self.gpio[2]}
@@ -204,11 +206,21 @@ function Module.getBlock(globals)
       c.PreInitCode:append("params.tdco = %i;" % {self.ssp.tdco})
     end
 
+    if self.rx_fifo ~= nil then
+      c.PreInitCode:append("params.rxMode = PLX_MCAN_RX_FIFO_%i;" % {self.rx_fifo})
+    else
+      c.PreInitCode:append("params.rxMode = PLX_MCAN_RX_BUFFERS;")
+    end
     c.PreInitCode:append("params.numRxMailboxes = %i;" % {self.num_rx_mailboxes})
     if self.num_rx_mailboxes ~= 0 then
       c.PreInitCode:append("static PLX_MCAN_RxMailbox_t rxMailboxes[%i];" % {self.num_rx_mailboxes})
       c.PreInitCode:append("params.rxMailboxes = &rxMailboxes[0];")
     end
+    if self.tx_queue then
+      c.PreInitCode:append("params.txMode = PLX_MCAN_TX_QUEUE;")
+    else
+      c.PreInitCode:append("params.txMode = PLX_MCAN_TX_BUFFERS;")
+    end
     c.PreInitCode:append("params.numTxMailboxes = %i;" % {self.num_tx_mailboxes})
     if self.num_tx_mailboxes ~= 0 then
       c.PreInitCode:append("static PLX_MCAN_TxMailbox_t txMailboxes[%i];" % {self.num_tx_mailboxes})
@@ -276,6 +288,20 @@ function Module.getBlock(globals)
         '  return PLX_MCAN_isErrorActive(MCanHandles[aChannel]);')
     c.Declarations:append('}')
 
+    c.Declarations:append('void PLXHAL_MCAN_poll(uint16_t aChannel){')
+    c.Declarations:append('  PLX_MCAN_poll(MCanHandles[aChannel]);')
+    c.Declarations:append('}')
+
+    c.Declarations:append('void PLXHAL_MCAN_flushTx(uint16_t aChannel){')
+    c.Declarations:append('  PLX_MCAN_flushTx(MCanHandles[aChannel]);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'uint32_t PLXHAL_MCAN_getTxDropCount(uint16_t aChannel, uint16_t aMailBox){')
+    c.Declarations:append(
+        '  return PLX_MCAN_getTxDropCount(MCanHandles[aChannel], aMailBox);')
+    c.Declarations:append('}')
+
     local code = [[
     {
       PLX_MCAN_sinit();
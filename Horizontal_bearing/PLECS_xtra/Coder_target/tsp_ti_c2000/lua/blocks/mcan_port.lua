@@ -130,6 +130,17 @@ function Module.getBlock(globals)
       end
     end
     
+    -- TX queue mode: staged messages are submitted once per tick by this block
+    self.tx_queue = (Block.Mask.TxMode == Block.Mask.TxMode) and
+                    (Block.Mask.TxMode ~= nil) and (Block.Mask.TxMode == 2)
+
+    -- RX FIFO mode: messages are drained once per tick by this block
+    local rx_fifo
+    if (Block.Mask.RxMode == Block.Mask.RxMode) and (Block.Mask.RxMode ~= nil)
+       and (Block.Mask.RxMode > 1) then
+      rx_fifo = Block.Mask.RxMode - 2
+    end
+
     local error = self.can_obj:configure({
       nom_sample_point = (Block.Mask.NomBitSamplePoint/100),
       nom_bit_rate = Block.Mask.NomBitRate,
@@ -141,11 +152,43 @@ function Module.getBlock(globals)
       data_sjw_tq = data_sjw_tq,
       ssp = ssp,
       gpio = Block.Mask.gpio,
+      rx_fifo = rx_fifo,
+      tx_queue = self.tx_queue,
     }, Require)
 
     if error ~= nil then
       return error
     end
+
+    if rx_fifo ~= nil then
+      OutputCode:append('PLXHAL_MCAN_poll(%i);\n' % {self.can_instance})
+    end
+
+    -- optional measurement and calibration server on this port
+    if (Block.Mask.EnableXcp == Block.Mask.EnableXcp) and (Block.Mask.EnableXcp == 2) then
+      for _, id in ipairs({Block.Mask.XcpCmdId, Block.Mask.XcpResId, Block.Mask.XcpDtoId}) do
+        if (math.floor(id) ~= id) or (id < 0) or (id > 0x1FFFFFFF) then
+          return 'Invalid XCP CAN identifier.'
+        end
+      end
+      if (math.floor(Block.Mask.XcpDaqLists) ~= Block.Mask.XcpDaqLists) or
+         (Block.Mask.XcpDaqLists < 1) or (Block.Mask.XcpDaqLists > 4) then
+        return 'Number of XCP DAQ lists must be between 1 and 4.'
+      end
+      local xcp_obj = self:makeBlock('xcp')
+      local xcpError = xcp_obj:createImplicit({
+        can_obj = self.can_obj,
+        is_mcan = true,
+        cmd_id = Block.Mask.XcpCmdId,
+        res_id = Block.Mask.XcpResId,
+        dto_id = Block.Mask.XcpDtoId,
+        num_daq_lists = Block.Mask.XcpDaqLists,
+        brs = (data_bit_rate ~= nil)
+      })
+      if xcpError ~= nil then
+        return xcpError
+      end
+    end
     
     if (Block.Mask.auto_buson == 2) then
       -- auto bus-on
@@ -189,7 +232,12 @@ function Module.getBlock(globals)
   end
 
   function CanPort:getNonDirectFeedthroughCode()
-    return {}
+    local UpdateCode = StringList:new()
+    if self.tx_queue then
+      -- after all CAN Transmit blocks of this tick have staged their messages
+      UpdateCode:append('PLXHAL_MCAN_flushTx(%i);\n' % {self.can_instance})
+    end
+    return {UpdateCode = UpdateCode}
   end
 
   function CanPort:finalizeThis(c)
@@ -122,9 +122,7 @@ function Module.getBlock(globals)
     while Block.Mask['Tsig%sMode' % {string.char(64 + s)}] ~= nil do
       local group = '%s' % {string.char(64 + s)}
       if Block.Mask['Tsig%sMode' % {group}] == 2 then
-        if not self.tripzones_obj:isTripSignalGroupConfigured(group) then
-          return 'Please configure trip signal %s under Coder Options -> Target -> Protections.' % {group}
-        end
+        -- checked in finalizeThis(), blocks may add trip signal groups
         self.trip_signal_groups[group] = 'osht'
       end
       s = s + 1
@@ -187,6 +185,12 @@ function Module.getBlock(globals)
   end
 
   function Powerstage:finalizeThis(c)
+    for group, _ in pairs(self.trip_signal_groups) do
+      if not self.tripzones_obj:isTripSignalGroupConfigured(group) then
+        return 'Please configure trip signal %s under Coder Options -> Target -> Protections.' % {group}
+      end
+    end
+
     local driverLibTarget = (globals.target.getFamilyPrefix() ~= '2806x') and
                             (globals.target.getFamilyPrefix() ~= '2833x')
 
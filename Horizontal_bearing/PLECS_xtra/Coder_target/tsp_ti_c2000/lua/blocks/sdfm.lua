@@ -0,0 +1,281 @@
+--[[
+  Copyright (c) 2022 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0, instances = {}, finalized = nil, dma = nil}
+
+local filterTypes = {
+  'PLX_SDFM_SINCFAST', 'PLX_SDFM_SINC1', 'PLX_SDFM_SINC2', 'PLX_SDFM_SINC3'
+}
+
+function Module.getBlock(globals)
+
+  local Sdfm = require('blocks.block').getBlock(globals)
+  Sdfm["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function Sdfm:checkMaskParameters(env)
+  end
+
+  function Sdfm:getDirectFeedthroughCode()
+    local Require = ResourceList:new()
+    local OutputCode = StringList:new()
+    local OutputSignal = StringList:new()
+
+    local sdfms = globals.target.getTargetParameters()['sdfms']
+    if sdfms == nil then
+      return 'This chip does not have a sigma-delta filter module (SDFM).'
+    end
+
+    self.unit = Block.Mask.sdfm
+    if self.unit > sdfms.num_units then
+      return 'SDFM%i not available on this chip.' % {self.unit}
+    end
+    table.insert(static.instances, self.bid)
+
+    local num_channels = Block.NumOutputSignals[1]
+    if (#Block.Mask.gpio_d ~= num_channels) or (#Block.Mask.gpio_c ~= num_channels) then
+      return 'Data and clock GPIOs must be specified for each filter channel.'
+    end
+
+    self.filter_type = filterTypes[Block.Mask.order]
+    self.osr = Block.Mask.osr
+    if (self.osr < 1) or (self.osr > 256) or (self.osr ~= math.floor(self.osr)) then
+      return 'Oversampling ratio must be an integer between 1 and 256.'
+    end
+
+    self.comp = (Block.Mask.comp == 2)
+    if self.comp then
+      self.comp_filter_type = filterTypes[Block.Mask.comp_order]
+      self.cosr = Block.Mask.cosr
+      if (self.cosr < 1) or (self.cosr > 32) or (self.cosr ~= math.floor(self.cosr)) then
+        return 'Comparator oversampling ratio must be an integer between 1 and 32.'
+      end
+    end
+
+    -- channels read together by a single PLXHAL_SDFM_getFrame() call
+    local frameMask = 0
+    local frameVarName = 'sdfm%iFrame' % {self.instance}
+    local pins = {}
+    local pinconf = {}
+    self.channels = {}
+    for i = 1, num_channels do
+      local ch = Block.Mask.channel[i]
+      if (ch < 1) or (ch > sdfms.num_channels) or (ch ~= math.floor(ch)) then
+        return 'Invalid filter channel %i for SDFM%i.' % {ch, self.unit}
+      end
+      Require:add('SDFM%i-FLT' % {self.unit}, ch)
+
+      for _, sig in ipairs({{'D', Block.Mask.gpio_d[i]}, {'C', Block.Mask.gpio_c[i]}}) do
+        local conf = 'GPIO_%i_SD%i_%s%i' % {sig[2], self.unit, sig[1], ch}
+        if not globals.target.validateAlternateFunction(conf) then
+          return 'GPIO%i cannot be used as SD%i_%s%i.' % {sig[2], self.unit, sig[1], ch}
+        end
+        table.insert(pins, sig[2])
+        table.insert(pinconf, conf)
+      end
+
+      local scale = globals.utils.getFromArrayOrScalar(Block.Mask.scale, i, num_channels)
+      if scale == nil then
+        return "Invalid width of parameter 'scale'."
+      end
+      if scale == 0 then
+        return "Scale must not be zero."
+      end
+
+      local offset = globals.utils.getFromArrayOrScalar(Block.Mask.offset, i, num_channels)
+      if offset == nil then
+        return "Invalid width of parameter 'offset'."
+      end
+
+      local p = {channel = ch - 1, scale = scale, offset = offset}
+      if self.comp then
+        local high = globals.utils.getFromArrayOrScalar(Block.Mask.threshold_high, i,
+                                                        num_channels)
+        local low = globals.utils.getFromArrayOrScalar(Block.Mask.threshold_low, i,
+                                                       num_channels)
+        if (high == nil) or (low == nil) then
+          return "Invalid width of trip threshold parameters."
+        end
+        if low >= high then
+          return "Lower trip threshold must be set below upper threshold."
+        end
+        -- thresholds normalized to the filter full scale
+        local a = (high - offset) / scale
+        local b = (low - offset) / scale
+        p.comp_high = math.max(a, b)
+        p.comp_low = math.min(a, b)
+      end
+      table.insert(self.channels, p)
+
+      frameMask = frameMask | (1 << p.channel)
+      OutputSignal:append('%s[%i]' % {frameVarName, p.channel})
+    end
+
+    globals.syscfg:addEntry('sdfm', {
+      unit = self.unit,
+      pins = pins,
+      pinconf = pinconf
+    })
+
+    if self.comp then
+      -- comparator events are OR'ed into the X-BAR trip input of the trip signal
+      local group = string.char(64 + Block.Mask.trip)
+      local trip = globals.target.getTargetParameters().trip_groups[group]
+      local tripzones_obj
+      for _, b in ipairs(globals.instances) do
+        if b:getType() == 'tripzones' then
+          tripzones_obj = b
+          break
+        end
+      end
+      if tripzones_obj == nil then
+        return 'TSP exception: TZs object not found.'
+      end
+      if not tripzones_obj:isTripSignalGroupConfigured(group) then
+        Require:add('XBAR_TRIP', trip, 'Trip signal %s' % {group})
+        tripzones_obj:addTripSignalGroup(group)
+      end
+      for _, p in ipairs(self.channels) do
+        local mux = 16 + 8 * (self.unit - 1) + 2 * p.channel
+        globals.syscfg:addEntry('epwm_xbar', {
+          trip = trip,
+          mux = mux,
+          muxconf = 'XBAR_EPWM_MUX%02i_SD%iFLT%i_COMPH_OR_COMPL' % {mux, self.unit, p.channel + 1}
+        })
+      end
+    end
+
+    if Block.Mask.dma == 2 then
+      if globals.target.getTargetParameters()['dmas'] == nil then
+        return 'This chip does not support DMA transfers of SDFM results.'
+      end
+      self.dma_channel = Block.Mask.dmach
+      Require:add('DMA', self.dma_channel)
+      static.dma = true
+    end
+
+    OutputCode:append('float %s[%i];\n' % {frameVarName, sdfms.num_channels})
+    OutputCode:append('PLXHAL_SDFM_getFrame(%i, %s, 0x%04X);\n' %
+                          {self.instance, frameVarName, frameMask})
+
+    return {
+      OutputCode = OutputCode,
+      OutputSignal = {OutputSignal},
+      Require = Require,
+      UserData = {bid = Sdfm:getId()}
+    }
+  end
+
+  function Sdfm:getNonDirectFeedthroughCode()
+    return {}
+  end
+
+  function Sdfm:finalizeThis(c)
+    c.PreInitCode:append(" // configure SDFM%i" % {self.unit})
+    c.PreInitCode:append("PLX_SDFM_configure(SdfmHandles[%i], PLX_SDFM_SD%i);" %
+                             {self.instance, self.unit})
+    for _, p in ipairs(self.channels) do
+      c.PreInitCode:append("{")
+      c.PreInitCode:append("  PLX_SDFM_ChannelParams_t params;")
+      c.PreInitCode:append("  PLX_SDFM_setDefaultChannelParams(&params);")
+      c.PreInitCode:append("  params.filterType = %s;" % {self.filter_type})
+      c.PreInitCode:append("  params.osr = %i;" % {self.osr})
+      c.PreInitCode:append("  params.scale = %.9ef;" % {p.scale})
+      c.PreInitCode:append("  params.offset = %.9ef;" % {p.offset})
+      if self.comp then
+        c.PreInitCode:append("  params.compEnable = true;")
+        c.PreInitCode:append("  params.compFilterType = %s;" % {self.comp_filter_type})
+        c.PreInitCode:append("  params.compOsr = %i;" % {self.cosr})
+        c.PreInitCode:append("  params.compHigh = %.9ef;" % {p.comp_high})
+        c.PreInitCode:append("  params.compLow = %.9ef;" % {p.comp_low})
+      end
+      c.PreInitCode:append("  PLX_SDFM_setupChannel(SdfmHandles[%i], %i, &params);" %
+                               {self.instance, p.channel})
+      c.PreInitCode:append("}")
+    end
+
+    if self.dma_channel ~= nil then
+      local results = 'SdfmDma%iResults' % {self.instance}
+      c.Declarations:append('#pragma DATA_SECTION(%s, "dmaram")' % {results})
+      c.Declarations:append('int16_t %s[%i];' %
+                                {results, globals.target.getTargetParameters()['sdfms'].num_channels})
+      c.PreInitCode:append(" // copy results with DMA CH%i on new data of filter %i" %
+                               {self.dma_channel, self.channels[1].channel + 1})
+      c.PreInitCode:append("PLX_SDFM_setupDma(SdfmHandles[%i], %i, %i, %s);" %
+                               {self.instance, self.dma_channel, self.channels[1].channel, results})
+    end
+    c.PreInitCode:append("PLX_SDFM_enable(SdfmHandles[%i]);" % {self.instance})
+    return c
+  end
+
+  function Sdfm:finalize(c)
+    if static.finalized ~= nil then
+      return {}
+    end
+
+    c.Include:append('plx_sdfm.h')
+    c.Declarations:append('PLX_SDFM_Handle_t SdfmHandles[%i];' %
+                              {static.numInstances})
+    c.Declarations:append('PLX_SDFM_Obj_t SdfmObj[%i];' % {static.numInstances})
+
+    c.Declarations:append(
+        'float PLXHAL_SDFM_getIn(uint16_t aHandle, uint16_t aChannel){')
+    c.Declarations:append(
+        '  return PLX_SDFM_getInF(SdfmHandles[aHandle], aChannel);')
+    c.Declarations:append('}')
+
+    c.Declarations:append(
+        'void PLXHAL_SDFM_getFrame(uint16_t aHandle, float *aOut, uint16_t aMask){')
+    c.Declarations:append(
+        '  PLX_SDFM_getFrameF(SdfmHandles[aHandle], aOut, aMask);')
+    c.Declarations:append('}')
+
+    if static.dma ~= nil then
+      c.Include:append('plx_dma.h')
+      c.PreInitCode:append('PLX_DMA_sinit();')
+    end
+
+    local code = [[
+    {
+      PLX_SDFM_sinit();
+      int i;
+      for(i=0; i<%d; i++)
+      {
+        SdfmHandles[i] = PLX_SDFM_init(&SdfmObj[i], sizeof(SdfmObj[i]));
+      }
+    }]]
+    c.PreInitCode:append(code % {static.numInstances})
+
+    for _, bid in pairs(static.instances) do
+      local sdfm = globals.instances[bid]
+      local c = sdfm:finalizeThis(c)
+      if type(c) == 'string' then
+        return c
+      end
+    end
+
+    static.finalized = true
+    return c
+  end
+
+  return Sdfm
+end
+
+return Module
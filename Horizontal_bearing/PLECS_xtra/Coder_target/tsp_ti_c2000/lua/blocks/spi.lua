@@ -43,6 +43,25 @@ function Module.getBlock(globals)
     self.phase = params.phase
     self.baudrate = params.baudrate
     self.masterslave = (params.baudrate > 0)
+    if params.dma ~= nil then
+      -- frames exchanged by DMA, see PLX_SPI_setupDmaFrames()
+      self.dma = params.dma
+      req:add('DMA', self.dma.tx_channel)
+      req:add('DMA', self.dma.rx_channel)
+      static.dma = true
+      if Target.Variables.targetCore == 2 then
+        -- GS14 must be assigned to CPU2 by the primary core (see syscfg.lua)
+        globals.syscfg:setEntry('dmaram', {core = 2})
+      end
+      if self.dma.slave then
+        static.dma_slave = true
+      end
+    end
+    if params.transactions then
+      -- slave sequence driven by the RX FIFO interrupt, see PLX_SPI_startTransactions()
+      self.transactions = true
+      static.transactions = true
+    end
 
     if (globals.target.getFamilyPrefix() == '2833x') or (globals.target.getFamilyPrefix() == '2806x') then
       -- older targets require hard-coded pin-sets
@@ -143,6 +162,88 @@ function Module.getBlock(globals)
                              {self.instance})
     end
     c.PreInitCode:append("}")
+
+    if self.dma ~= nil then
+      local txFrame = 'SpiDma%iTxFrame' % {self.instance}
+      local rxFrames = 'SpiDma%iRxFrames' % {self.instance}
+      c.Declarations:append('#pragma DATA_SECTION(%s, "dmaram")' % {txFrame})
+      c.Declarations:append('uint16_t %s[%i];' % {txFrame, self.dma.frame_size})
+      c.Declarations:append('#pragma DATA_SECTION(%s, "dmaram")' % {rxFrames})
+      c.Declarations:append('uint16_t %s[%i];' % {rxFrames, 2 * self.dma.frame_size})
+      c.PreInitCode:append(
+          " // exchange frames of %i words with DMA CH%i (TX) and CH%i (RX)" %
+              {self.dma.frame_size, self.dma.tx_channel, self.dma.rx_channel})
+      if self.dma.slave then
+        c.PreInitCode:append(
+            "PLX_SPI_setupDmaSlaveFrames(SpiHandles[%i], %i, %i, %i, %s, %s, %i);" %
+                {
+                  self.instance, self.dma.tx_channel, self.dma.rx_channel,
+                  self.dma.ste_gpio, txFrame, rxFrames, self.dma.frame_size
+                })
+
+        -- RX DMA channel interrupt (PIE group 7) switches the frame banks
+        local isr = '%s_spi%sDmaRxInterrupt' % {Target.Variables.BASE_NAME, self.spi_letter}
+        local itFunction = [[
+        interrupt void %(isr)s(void)
+        {
+          PLX_SPI_dmaSlaveRxIsr(SpiHandles[%(instance)i]);
+          PieCtrlRegs.PIEACK.all = PIEACK_GROUP7;
+        }
+        ]]
+        c.Declarations:append("%s\n" % {itFunction % {
+          isr = isr,
+          instance = self.instance
+        }})
+
+        local isrConfigCode = [[
+        EALLOW;
+        PieVectTable.DMA_CH%(ch)i_INT = &%(isr)s;
+        EDIS;
+        PieCtrlRegs.PIEIER7.bit.INTx%(ch)i = 1;
+        ]]
+        c.PreInitCode:append(isrConfigCode % {
+          ch = self.dma.rx_channel,
+          isr = isr
+        })
+        c.InterruptEnableCode:append('IER |= M_INT7;')
+      else
+        c.PreInitCode:append(
+            "PLX_SPI_setupDmaFrames(SpiHandles[%i], %i, %i, %s, %s, %s, %i);" %
+                {
+                  self.instance, self.dma.tx_channel, self.dma.rx_channel,
+                  self.dma.trigger, txFrame, rxFrames, self.dma.frame_size
+                })
+      end
+      c.PreInitCode:append("PLX_SPI_startDmaFrames(SpiHandles[%i]);" % {self.instance})
+    end
+
+    if self.transactions then
+      local isr = '%s_spi%sRxInterrupt' % {Target.Variables.BASE_NAME, self.spi_letter}
+      local itFunction = [[
+      interrupt void %(isr)s(void)
+      {
+        PLX_SPI_transactionIsr(SpiHandles[%(instance)i]);
+        PieCtrlRegs.PIEACK.all = PIEACK_GROUP6;
+      }
+      ]]
+      c.Declarations:append("%s\n" % {itFunction % {
+        isr = isr,
+        instance = self.instance
+      }})
+
+      local isrConfigCode = [[
+      EALLOW;
+      PieVectTable.SPI%(unit)s_RX_INT = &%(isr)s;
+      EDIS;
+      PieCtrlRegs.PIEIER6.bit.INTx%(pie)i = 1;
+      ]]
+      c.PreInitCode:append(isrConfigCode % {
+        unit = self.spi_letter,
+        isr = isr,
+        pie = 1 + 2*self.spi -- SPIA RX: INTx1, SPIB RX: INTx3
+      })
+      c.InterruptEnableCode:append('IER |= M_INT6;')
+    end
     return c
   end
 
@@ -180,6 +281,57 @@ function Module.getBlock(globals)
         '  return PLX_SPI_getAndResetRxOverrunFlag(SpiHandles[aChannel]);')
     c.Declarations:append('}')
 
+    if static.dma ~= nil then
+      c.Declarations:append(
+          'uint16_t *PLXHAL_SPI_getDmaTxFrame(int16_t aChannel){')
+      c.Declarations:append(
+          '  return PLX_SPI_getDmaTxFrame(SpiHandles[aChannel]);')
+      c.Declarations:append('}')
+
+      c.Declarations:append(
+          'bool PLXHAL_SPI_getDmaRxFrame(int16_t aChannel, uint16_t **aFrame){')
+      c.Declarations:append(
+          '  return PLX_SPI_getDmaRxFrame(SpiHandles[aChannel], aFrame);')
+      c.Declarations:append('}')
+
+      c.Include:append('plx_dma.h')
+      c.PreInitCode:append('PLX_DMA_sinit();')
+    end
+
+    if static.dma_slave ~= nil then
+      c.Declarations:append(
+          'bool PLXHAL_SPI_getDmaSlaveRxFrame(int16_t aChannel, uint16_t **aFrame){')
+      c.Declarations:append(
+          '  return PLX_SPI_getDmaSlaveRxFrame(SpiHandles[aChannel], aFrame);')
+      c.Declarations:append('}')
+
+      c.Declarations:append(
+          'uint32_t PLXHAL_SPI_getDmaFrameCount(int16_t aChannel){')
+      c.Declarations:append(
+          '  return PLX_SPI_getDmaFrameCount(SpiHandles[aChannel]);')
+      c.Declarations:append('}')
+
+      c.Declarations:append(
+          'uint32_t PLXHAL_SPI_getDmaFramingErrorCount(int16_t aChannel){')
+      c.Declarations:append(
+          '  return PLX_SPI_getDmaFramingErrorCount(SpiHandles[aChannel]);')
+      c.Declarations:append('}')
+    end
+
+    if static.transactions ~= nil then
+      c.Declarations:append(
+          'bool PLXHAL_SPI_startTransactions(int16_t aChannel, uint16_t *aTxData, uint16_t *aRxData){')
+      c.Declarations:append(
+          '  return PLX_SPI_startTransactions(SpiHandles[aChannel], aTxData, aRxData);')
+      c.Declarations:append('}')
+
+      c.Declarations:append(
+          'bool PLXHAL_SPI_transactionsBusy(int16_t aChannel){')
+      c.Declarations:append(
+          '  return PLX_SPI_transactionsBusy(SpiHandles[aChannel]);')
+      c.Declarations:append('}')
+    end
+
     local code = [[
     {
       PLX_SPI_sinit();
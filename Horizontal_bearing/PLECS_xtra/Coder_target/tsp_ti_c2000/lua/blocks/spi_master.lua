@@ -55,13 +55,52 @@ function Module.getBlock(globals)
         return "Invalid \'Mode\' parameter for SPI module"
     end
 
+    -- optional frame transfer by DMA, /CS is then driven by the SPI module (STE)
+    local gpio = Block.Mask.pinset
+    local dma
+    if (Block.Mask.dma ~= nil) and (Block.Mask.dma == 2) then
+      if globals.target.getTargetParameters()['dmas'] == nil then
+        return 'This chip does not support DMA transfers of SPI frames.'
+      end
+      if (#Block.Mask.csgpio ~= 1) or (#Block.Mask.dim ~= 1) then
+        return 'DMA transfers are limited to a single slave.'
+      end
+      local trigger
+      if Block.Mask.dmatrig == 1 then
+        local numEpwms = #globals.target.getTargetParameters()['epwms']['gpio']
+        local epwm = Block.Mask.dmaepwm
+        if (epwm ~= math.floor(epwm)) or (epwm < 1) or (epwm > numEpwms) then
+          return 'Invalid ePWM unit for DMA trigger.'
+        end
+        self.dma_epwm = epwm
+        trigger = 'PLX_DMA_TRIGGER_EPWM_SOCA(%i)' % {epwm}
+      else
+        self.dma_timer = 0
+        trigger = 'PLX_DMA_TRIGGER_TINT0'
+      end
+      gpio = {gpio[1], gpio[2], gpio[3], Block.Mask.csgpio[1]}
+      dma = {
+        tx_channel = 1 + 2 * self.spi,
+        rx_channel = 2 + 2 * self.spi,
+        trigger = trigger,
+        frame_size = Block.Mask.dim[1]
+      }
+    end
+
+    -- without DMA, newer targets sequence the slaves from the SPI RX interrupt
+    local transactions = (dma == nil) and
+                         (globals.target.getFamilyPrefix() ~= '2806x') and
+                         (globals.target.getFamilyPrefix() ~= '2833x')
+
     self.spi_obj = self:makeBlock('spi')
     local error = self.spi_obj:createImplicit(self.spi, {
       charlen = Block.Mask.charlen,
       pol = (mode >= 2),
       phase = (mode == 0) or (mode == 2),
       baudrate = Block.Mask.clk,
-      gpio = Block.Mask.pinset
+      gpio = gpio,
+      dma = dma,
+      transactions = transactions
     }, Require)
     if error ~= nil then
       return error
@@ -76,37 +115,55 @@ function Module.getBlock(globals)
 
     local masterVarPrefix = "SpiMaster%i" % {self.spi_instance}
 
+    if dma ~= nil then
+      return self:getDmaFrameCode(masterVarPrefix, dma.frame_size, Require)
+    end
+
     -- setup chip selects
     local csArrayString = ""
+    local csChannels = {}
     for i = 1, #Block.Mask.csgpio do
       local dio_obj = self:makeBlock('dout')
       local cs = dio_obj:createImplicit(Block.Mask.csgpio[i], {}, Require)
       if type(cs) == 'string' then
         return cs
       end
+      csChannels[i] = cs
       csArrayString = csArrayString .. "%i" % {cs}
       if i ~= #Block.Mask.csgpio then
         csArrayString = csArrayString .. ", "
       end
     end
-    OutputCode:append("static uint16_t %sSlaveCsHandles[] = {%s};\n" %
-                          {masterVarPrefix, csArrayString})
 
     -- setup message size vector
     local spi_fifo_depth =
         globals.target.getTargetParameters()['spis']['fifo_depth']
     local dimArrayString = ""
+    local numWords = 0
     for i = 1, #Block.Mask.dim do
       if Block.Mask.dim[i] > spi_fifo_depth then
         return
             "Maximum number of words per transmission for this target equals %i." %
                 {spi_fifo_depth}
       end
+      numWords = numWords + Block.Mask.dim[i]
       dimArrayString = dimArrayString .. "%i" % {Block.Mask.dim[i]}
       if i ~= #Block.Mask.dim then
         dimArrayString = dimArrayString .. ", "
       end
     end
+    if transactions then
+      if numWords ~= #Block.InputSignal[1] then
+        return "Total number of words per transmission (%i) must match the width of the data input (%i)." %
+                   {numWords, #Block.InputSignal[1]}
+      end
+      self.cs_channels = csChannels
+      self.cs_words = Block.Mask.dim
+      return self:getTransactionCode(masterVarPrefix, Require)
+    end
+
+    OutputCode:append("static uint16_t %sSlaveCsHandles[] = {%s};\n" %
+                          {masterVarPrefix, csArrayString})
     OutputCode:append(
         "static uint16_t %sSlaveWordsPerTransmission[] = {%s};\n" %
             {masterVarPrefix, dimArrayString})
@@ -216,11 +273,162 @@ function Module.getBlock(globals)
     }
   end
 
+  function SpiMaster:getTransactionCode(masterVarPrefix, Require)
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+    local numWords = #Block.InputSignal[1]
+
+    -- the RX interrupt fills RxDataBuffer while the next tick is pending
+    OutputCode:append("static uint16_t %sTxData[%i];\n" % {masterVarPrefix, numWords})
+    OutputCode:append("static uint16_t %sRxDataBuffer[%i];\n" % {masterVarPrefix, numWords})
+    OutputCode:append("static uint16_t %sRxData[%i];\n" % {masterVarPrefix, numWords})
+    OutputCode:append("static bool %sStarted = false;\n" % {masterVarPrefix})
+    OutputCode:append("static bool %sReady = false;\n" % {masterVarPrefix})
+    OutputCode:append("static bool %sTxOverrun = false;\n" % {masterVarPrefix})
+    OutputCode:append("{\n")
+    OutputCode:append("  %sReady = false;\n" % {masterVarPrefix})
+    OutputCode:append("  %sTxOverrun = PLXHAL_SPI_transactionsBusy(%i);\n" %
+                          {masterVarPrefix, self.spi_instance})
+    OutputCode:append("  if(!%sTxOverrun)\n" % {masterVarPrefix})
+    OutputCode:append("  {\n")
+    OutputCode:append("    if(%sStarted)\n" % {masterVarPrefix})
+    OutputCode:append("    {\n")
+    for i = 1, numWords do
+      OutputCode:append("      %sRxData[%i] = %sRxDataBuffer[%i];\n" %
+                            {masterVarPrefix, i - 1, masterVarPrefix, i - 1})
+    end
+    OutputCode:append("      %sReady = true;\n" % {masterVarPrefix})
+    OutputCode:append("    }\n")
+    for i = 1, numWords do
+      OutputCode:append("    %sTxData[%i] = %s;\n" %
+                            {masterVarPrefix, i - 1, Block.InputSignal[1][i]})
+    end
+    OutputCode:append("    %sStarted = PLXHAL_SPI_startTransactions(%i, %sTxData, %sRxDataBuffer);\n" %
+                          {masterVarPrefix, self.spi_instance, masterVarPrefix, masterVarPrefix})
+    OutputCode:append("  }\n")
+    OutputCode:append("}\n")
+
+    OutputSignal[1] = {}
+    for i = 1, numWords do
+      OutputSignal[1][i] = "%sRxData[%i]" % {masterVarPrefix, i - 1}
+    end
+    OutputSignal[2] = {}
+    OutputSignal[2][1] = "%sReady" % {masterVarPrefix}
+    OutputSignal[3] = {}
+    OutputSignal[3][1] = "%sTxOverrun" % {masterVarPrefix}
+
+    return {
+      OutputCode = OutputCode,
+      OutputSignal = OutputSignal,
+      Require = Require,
+      UserData = {bid = SpiMaster:getId()}
+    }
+  end
+
+  function SpiMaster:getDmaFrameCode(masterVarPrefix, dim, Require)
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+
+    local spi_fifo_depth =
+        globals.target.getTargetParameters()['spis']['fifo_depth']
+    if dim > spi_fifo_depth then
+      return
+          "Maximum number of words per transmission for this target equals %i." %
+              {spi_fifo_depth}
+    end
+
+    -- the DMA bypasses the word shift and mask of the FIFO accessors
+    local charlen = Block.Mask.charlen
+    local txShift = 16 - charlen
+    local rxMask = math.floor(2 ^ charlen) - 1
+
+    OutputCode:append("static uint16_t *%sRxFrame;\n" % {masterVarPrefix})
+    OutputCode:append("static bool %sReady = false;\n" % {masterVarPrefix})
+    OutputCode:append("static bool %sTxOverrun = false;\n" % {masterVarPrefix})
+    OutputCode:append("{\n")
+    OutputCode:append("  %sReady = PLXHAL_SPI_getDmaRxFrame(%i, &%sRxFrame);\n" %
+                          {masterVarPrefix, self.spi_instance, masterVarPrefix})
+    OutputCode:append("  %sTxOverrun = PLXHAL_SPI_getAndResetRxOverrunFlag(%i);\n" %
+                          {masterVarPrefix, self.spi_instance})
+    OutputCode:append("  // sent with next DMA trigger\n")
+    OutputCode:append("  uint16_t *txFrame = PLXHAL_SPI_getDmaTxFrame(%i);\n" %
+                          {self.spi_instance})
+    for i = 1, dim do
+      if txShift > 0 then
+        OutputCode:append("  txFrame[%i] = (uint16_t)(%s) << %i;\n" %
+                              {i - 1, Block.InputSignal[1][i], txShift})
+      else
+        OutputCode:append("  txFrame[%i] = %s;\n" %
+                              {i - 1, Block.InputSignal[1][i]})
+      end
+    end
+    OutputCode:append("}\n")
+
+    OutputSignal[1] = {}
+    for i = 1, dim do
+      if txShift > 0 then
+        OutputSignal[1][i] = "(%sRxFrame[%i] & 0x%04X)" %
+                                 {masterVarPrefix, i - 1, rxMask}
+      else
+        OutputSignal[1][i] = "%sRxFrame[%i]" % {masterVarPrefix, i - 1}
+      end
+    end
+    OutputSignal[2] = {}
+    OutputSignal[2][1] = "%sReady" % {masterVarPrefix}
+    OutputSignal[3] = {}
+    OutputSignal[3][1] = "%sTxOverrun" % {masterVarPrefix}
+
+    return {
+      OutputCode = OutputCode,
+      OutputSignal = OutputSignal,
+      Require = Require,
+      UserData = {bid = SpiMaster:getId()}
+    }
+  end
+
   function SpiMaster:getNonDirectFeedthroughCode()
     return {}
   end
 
   function SpiMaster:finalizeThis(c)
+    if self.cs_channels ~= nil then
+      -- DoutHandles are only valid after pre-init
+      local transTable = 'SpiMaster%iTransactions' % {self.spi_instance}
+      c.Declarations:append('PLX_SPI_Transaction_t %s[%i];' % {transTable, #self.cs_channels})
+      for i, cs in ipairs(self.cs_channels) do
+        c.PostInitCode:append('%s[%i].cs = DoutHandles[%i];' % {transTable, i - 1, cs})
+        c.PostInitCode:append('%s[%i].len = %i;' % {transTable, i - 1, self.cs_words[i]})
+      end
+      c.PostInitCode:append('PLX_SPI_setupTransactions(SpiHandles[%i], %s, %i);' %
+                                {self.spi_instance, transTable, #self.cs_channels})
+    end
+
+    -- the DMA trigger must be generated by another block
+    if self.dma_epwm ~= nil then
+      local socEnabled = false
+      for _, b in ipairs(globals.instances) do
+        if (b:getType() == 'epwm') and (b:getParameter('epwm') == self.dma_epwm) then
+          local soc_loc = b:getParameter('soc_loc')
+          if (soc_loc ~= nil) and (soc_loc ~= '') then
+            socEnabled = true
+          end
+        end
+      end
+      if not socEnabled then
+        return 'ePWM%i does not generate the SOCA event required to trigger the SPI DMA transfer. Use it to trigger an ADC.' %
+                   {self.dma_epwm}
+      end
+    elseif self.dma_timer ~= nil then
+      local timerEnabled = false
+      for _, b in ipairs(globals.instances) do
+        if b:getType() == 'timer' then
+          timerEnabled = true
+        end
+      end
+      if not timerEnabled then
+        return 'CPU timer 0 is not running to trigger the SPI DMA transfer.'
+      end
+    end
     return c
   end
 
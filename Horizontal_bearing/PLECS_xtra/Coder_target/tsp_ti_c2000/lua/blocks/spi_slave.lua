@@ -52,13 +52,29 @@ function Module.getBlock(globals)
         return "Invalid \'Mode\' parameter for SPI module"
     end
 
+    -- optional frame transfer by DMA, the RX DMA interrupt alternates the frame banks
+    local dma
+    if (Block.Mask.dma ~= nil) and (Block.Mask.dma == 2) then
+      if globals.target.getTargetParameters()['dmas'] == nil then
+        return 'This chip does not support DMA transfers of SPI frames.'
+      end
+      dma = {
+        tx_channel = 1 + 2 * self.spi,
+        rx_channel = 2 + 2 * self.spi,
+        slave = true,
+        ste_gpio = Block.Mask.pinset[4],
+        frame_size = Block.Mask.dim
+      }
+    end
+
     self.spi_obj = self:makeBlock('spi')
     local error = self.spi_obj:createImplicit(self.spi, {
       charlen = Block.Mask.charlen,
       pol = (mode >= 2),
       phase = (mode == 0) or (mode == 2),
       baudrate = 0, -- slave
-      gpio = Block.Mask.pinset
+      gpio = Block.Mask.pinset,
+      dma = dma
     }, Require)
     if error ~= nil then
       return error
@@ -75,6 +91,10 @@ function Module.getBlock(globals)
               {spi_fifo_depth}
     end
 
+    if dma ~= nil then
+      return self:getDmaFrameCode(dim, Require)
+    end
+
     -- setup I/O buffers
     OutputCode:append("static uint16_t SpiSlave%iRxBuffer[%i] = {" %
                           {self.spi_instance, dim})
@@ -132,6 +152,64 @@ function Module.getBlock(globals)
     }
   end
 
+  function SpiSlave:getDmaFrameCode(dim, Require)
+    local OutputSignal = StringList:new()
+    local OutputCode = StringList:new()
+    local prefix = 'SpiSlave%i' % {self.spi_instance}
+
+    -- the DMA bypasses the word shift and mask of the FIFO accessors
+    local charlen = Block.Mask.charlen
+    local txShift = 16 - charlen
+    local rxMask = math.floor(2 ^ charlen) - 1
+
+    OutputCode:append("static uint16_t *%sRxFrame;\n" % {prefix})
+    OutputCode:append("static bool %sDataReady = false;\n" % {prefix})
+    OutputCode:append("static bool %sRxOverrun = false;\n" % {prefix})
+    OutputCode:append("static uint32_t %sFramingErrors = 0;\n" % {prefix})
+    OutputCode:append("{\n")
+    OutputCode:append("  %sDataReady = PLXHAL_SPI_getDmaSlaveRxFrame(%i, &%sRxFrame);\n" %
+                          {prefix, self.spi_instance, prefix})
+    OutputCode:append("  // FIFO overflow or frames dropped for misalignment since the last step\n")
+    OutputCode:append("  uint32_t framingErrors = PLXHAL_SPI_getDmaFramingErrorCount(%i);\n" %
+                          {self.spi_instance})
+    OutputCode:append("  %sRxOverrun = PLXHAL_SPI_getAndResetRxOverrunFlag(%i) || (framingErrors != %sFramingErrors);\n" %
+                          {prefix, self.spi_instance, prefix})
+    OutputCode:append("  %sFramingErrors = framingErrors;\n" % {prefix})
+    OutputCode:append("  // loaded into the TX FIFO once the master has clocked out the current frame\n")
+    OutputCode:append("  uint16_t *txFrame = PLXHAL_SPI_getDmaTxFrame(%i);\n" %
+                          {self.spi_instance})
+    for i = 1, dim do
+      if txShift > 0 then
+        OutputCode:append("  txFrame[%i] = (uint16_t)(%s) << %i;\n" %
+                              {i - 1, Block.InputSignal[1][i], txShift})
+      else
+        OutputCode:append("  txFrame[%i] = %s;\n" %
+                              {i - 1, Block.InputSignal[1][i]})
+      end
+    end
+    OutputCode:append("}\n")
+
+    OutputSignal[1] = {}
+    for i = 1, dim do
+      if txShift > 0 then
+        OutputSignal[1][i] = "(%sRxFrame[%i] & 0x%04X)" % {prefix, i - 1, rxMask}
+      else
+        OutputSignal[1][i] = "%sRxFrame[%i]" % {prefix, i - 1}
+      end
+    end
+    OutputSignal[2] = {}
+    OutputSignal[2][1] = "%sDataReady" % {prefix}
+    OutputSignal[3] = {}
+    OutputSignal[3][1] = "%sRxOverrun" % {prefix}
+
+    return {
+      OutputSignal = OutputSignal,
+      OutputCode = OutputCode,
+      Require = Require,
+      UserData = {bid = SpiSlave:getId()}
+    }
+  end
+
   function SpiSlave:getNonDirectFeedthroughCode()
     return {}
   end
@@ -174,6 +174,50 @@ function Module.getBlock(globals)
       end
     end
 
+    if sysCfg['fsi'] ~= nil then
+      for _, fsi in ipairs(sysCfg['fsi']) do
+        for i=1,#fsi.pins do
+          if fsi.rx then
+            -- receiver inputs must not be qualified
+            f.PostInitCode:append("GPIO_setQualificationMode(%i, GPIO_QUAL_ASYNC);" % {fsi.pins[i]})
+          end
+          f.PostInitCode:append("GPIO_setPinConfig(%s);" % {fsi.pinconf[i]})
+        end
+        if fsi.core == 2 then
+          return "FSI not supported on CPU2."
+        end
+      end
+    end
+
+    if sysCfg['sdfm'] ~= nil then
+      for _, sdfm in ipairs(sysCfg['sdfm']) do
+        for i=1,#sdfm.pins do
+          -- modulator data and clock must not be qualified
+          f.PostInitCode:append("GPIO_setQualificationMode(%i, GPIO_QUAL_ASYNC);" % {sdfm.pins[i]})
+          f.PostInitCode:append("GPIO_setPinConfig(%s);" % {sdfm.pinconf[i]})
+        end
+        if sdfm.core == 2 then
+          return "SDFM not supported on CPU2."
+        end
+      end
+    end
+
+    if sysCfg['i2c'] ~= nil then
+      for _, i2c in ipairs(sysCfg['i2c']) do
+        unit_n = 1+string.byte(i2c["unit"])-string.byte('A')
+        for i=1,#i2c.pins do
+          f.PostInitCode:append([[
+            GPIO_setPadConfig(%(pin)i, GPIO_PIN_TYPE_PULLUP);
+            GPIO_setQualificationMode(%(pin)i, GPIO_QUAL_ASYNC);
+            GPIO_setPinConfig(%(conf)s);]] %
+          {pin = i2c.pins[i], conf = i2c.pinconf[i]})
+        end
+        if i2c.core == 2 then
+          f.PreInitCode:append("SysCtl_selectCPUForPeripheral(SYSCTL_CPUSEL7_I2C, %(unit_n)i, SYSCTL_CPUSEL_CPU2);" % {unit_n = unit_n})
+        end
+      end
+    end
+
     if sysCfg['qep'] ~= nil then
       for _, qep in ipairs(sysCfg['qep']) do
         for _, pin in ipairs(qep.pins) do
@@ -256,6 +300,11 @@ function Module.getBlock(globals)
       end
     end
     
+    if (sysCfg['dmaram'] ~= nil) and (sysCfg['dmaram'].core == 2) then
+      f.Include:append('memcfg.h')
+      f.PreInitCode:append("MemCfg_setGSRAMMasterSel(MEMCFG_SECT_GS14, MEMCFG_GSRAMMASTER_CPU2);")
+    end
+
     f.PreInitCode:append("}")
     f.PostInitCode:append("}")
     return f
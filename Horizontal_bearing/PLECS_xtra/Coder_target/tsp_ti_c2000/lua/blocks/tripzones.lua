@@ -132,6 +132,12 @@ function Module.getBlock(globals)
     return (static.trip_signal_groups_configured[group] ~= nil)
   end
 
+  -- trip signal group driven by a block (e.g. SDFM comparators) rather than
+  -- the protection settings
+  function TripZones:addTripSignalGroup(group)
+    static.trip_signal_groups_configured[group] = true
+  end
+
   function TripZones:isAnyTripZoneOrGroupConfigured()
     return (next(static.trip_zones_configured) ~= nil) or
             (next(static.trip_signal_groups_configured) ~= nil)
@@ -0,0 +1,244 @@
+--[[
+  Copyright (c) 2021 by Plexim GmbH
+  All rights reserved.
+
+  A free license is granted to anyone to use this software for any legal
+  non safety-critical purpose, including commercial applications, provided
+  that:
+  1) IT IS NOT USED TO DIRECTLY OR INDIRECTLY COMPETE WITH PLEXIM, and
+  2) THIS COPYRIGHT NOTICE IS PRESERVED in its entirety.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+--]] --
+local Module = {}
+
+local static = {numInstances = 0, instances = {}, finalized = nil}
+
+function Module.getBlock(globals)
+
+  local Xcp = require('blocks.block').getBlock(globals)
+  Xcp["instance"] = static.numInstances
+  static.numInstances = static.numInstances + 1
+
+  function Xcp:checkMaskParameters(env)
+    return "Explicit use of XCP via target block not supported."
+  end
+
+  function Xcp:getDirectFeedthroughCode()
+    return "Explicit use of XCP via target block not supported."
+  end
+
+  -- params: can_obj, is_mcan, cmd_id, res_id, dto_id, num_daq_lists, brs
+  function Xcp:createImplicit(params)
+    table.insert(static.instances, self.bid)
+
+    self.can_instance = params.can_obj:getParameter('instance')
+    self.is_mcan = params.is_mcan
+    self.num_daq_lists = params.num_daq_lists
+
+    -- MCAN: classic CTO, one CAN FD frame per DAQ list
+    self.cto_len = 8
+    if self.is_mcan then
+      self.dto_len = 64
+    else
+      self.dto_len = 8
+    end
+
+    local function isExt(id)
+      return (id > 0x7FF)
+    end
+
+    self.cmd_mbox = params.can_obj:getRxMailbox()
+    if type(self.cmd_mbox) == 'string' then
+      return self.cmd_mbox
+    end
+    params.can_obj:setupRxMailbox(self.cmd_mbox, {
+      can_id = params.cmd_id,
+      ext_id = isExt(params.cmd_id),
+      width = self.cto_len,
+      dlc = self.cto_len
+    })
+
+    self.res_mbox = params.can_obj:getTxMailbox()
+    if type(self.res_mbox) == 'string' then
+      return self.res_mbox
+    end
+    params.can_obj:setupTxMailbox(self.res_mbox, {
+      can_id = params.res_id,
+      ext_id = isExt(params.res_id),
+      width = self.cto_len,
+      dlc = self.cto_len,
+      brs = false
+    })
+
+    -- one mailbox per DAQ list, so lists of the same event do not block each other
+    self.dto_mboxes = {}
+    for i = 1, self.num_daq_lists do
+      local mbox = params.can_obj:getTxMailbox()
+      if type(mbox) == 'string' then
+        return mbox
+      end
+      params.can_obj:setupTxMailbox(mbox, {
+        can_id = params.dto_id,
+        ext_id = isExt(params.dto_id),
+        width = self.dto_len,
+        dlc = (self.dto_len == 64) and 15 or self.dto_len,
+        brs = params.brs
+      })
+      self.dto_mboxes[i] = mbox
+    end
+
+    self:logLine('XCP server on CAN instance %i implicitly created.' % {self.can_instance})
+  end
+
+  function Xcp:getProbeTableCode()
+    local typeMap = {
+      uint16_t = 'PLX_XCP_UINT16',
+      int16_t = 'PLX_XCP_INT16',
+      uint32_t = 'PLX_XCP_UINT32',
+      int32_t = 'PLX_XCP_INT32',
+      float = 'PLX_XCP_FLOAT'
+    }
+
+    local pil_obj
+    for _, b in ipairs(globals.instances) do
+      if b:getType() == 'pil' then
+        pil_obj = b
+      end
+    end
+
+    local entries = {}
+    if pil_obj ~= nil then
+      local function add(probes, writable)
+        for name, par in pairs(probes) do
+          local type = typeMap[par['type']]
+          if type == nil then
+            self:logLine('PIL symbol %s of type %s not accessible via XCP.' % {name, par['type']})
+          elseif writable then
+            table.insert(entries, '{&%s_probes.%s, %s, true, %f, %f}' % {
+              Target.Variables.BASE_NAME, name, type, par['min'], par['max']
+            })
+          else
+            table.insert(entries, '{&%s_probes.%s, %s, false, 0, 0}' % {
+              Target.Variables.BASE_NAME, name, type
+            })
+          end
+        end
+      end
+      add(pil_obj:getParameter('read_probes'), false)
+      add(pil_obj:getParameter('override_probes'), false)
+      add(pil_obj:getParameter('calibrations'), true)
+    end
+
+    if #entries == 0 then
+      return 'static const PLX_XCP_Probe_t XcpProbes%i[1] = {{0, PLX_XCP_UINT16, false, 0, 0}};' % {self.instance}, 0
+    end
+    return 'static const PLX_XCP_Probe_t XcpProbes%i[%i] = {\n  %s\n};' % {
+      self.instance, #entries, table.concat(entries, ',\n  ')
+    }, #entries
+  end
+
+  function Xcp:finalizeThis(c)
+    local transport
+    if self.is_mcan then
+      transport = [[
+      static bool XcpRx%(instance)i(uint16_t aMailBox, unsigned char data[], unsigned char lenMax){
+        uint16_t flags;
+        return PLX_MCAN_getMessage(MCanHandles[%(can)i], aMailBox, data, lenMax, &flags);
+      }
+      static bool XcpTx%(instance)i(uint16_t aMailBox, const unsigned char data[], unsigned char len){
+        return PLX_MCAN_putMessage(MCanHandles[%(can)i], aMailBox, data, len);
+      }
+      ]]
+    else
+      transport = [[
+      static bool XcpRx%(instance)i(uint16_t aMailBox, unsigned char data[], unsigned char lenMax){
+        return PLX_CANBUS_getMessage(CanHandles[%(can)i], aMailBox, data, lenMax);
+      }
+      static bool XcpTx%(instance)i(uint16_t aMailBox, const unsigned char data[], unsigned char len){
+        return PLX_CANBUS_putMessage(CanHandles[%(can)i], aMailBox, data, len);
+      }
+      ]]
+    end
+    c.Declarations:append(transport % {
+      instance = self.instance,
+      can = self.can_instance
+    })
+
+    local probeTable, numProbes = self:getProbeTableCode()
+    c.Declarations:append(probeTable)
+
+    c.PreInitCode:append("{")
+    c.PreInitCode:append("  PLX_XCP_Params_t params;")
+    c.PreInitCode:append("  params.rx = &XcpRx%i;" % {self.instance})
+    c.PreInitCode:append("  params.tx = &XcpTx%i;" % {self.instance})
+    c.PreInitCode:append("  params.cmdMailbox = %i;" % {self.cmd_mbox})
+    c.PreInitCode:append("  params.resMailbox = %i;" % {self.res_mbox})
+    for i = 1, self.num_daq_lists do
+      c.PreInitCode:append("  params.dtoMailboxes[%i] = %i;" % {i - 1, self.dto_mboxes[i]})
+    end
+    c.PreInitCode:append("  params.numDaqLists = %i;" % {self.num_daq_lists})
+    c.PreInitCode:append("  params.ctoLen = %i;" % {self.cto_len})
+    c.PreInitCode:append("  params.dtoLen = %i;" % {self.dto_len})
+    c.PreInitCode:append("  params.numEvents = %i;" % {#Model.Tasks})
+    c.PreInitCode:append("  params.probes = &XcpProbes%i[0];" % {self.instance})
+    c.PreInitCode:append("  params.numProbes = %i;" % {numProbes})
+    c.PreInitCode:append("  PLX_XCP_configure(XcpHandles[%i], &params);" % {self.instance})
+    c.PreInitCode:append("}")
+
+    c.BackgroundTaskCodeBlocks:append("PLX_XCP_poll(XcpHandles[%i]);" % {self.instance})
+    return c
+  end
+
+  function Xcp:finalize(c)
+    if static.finalized ~= nil then
+      return {}
+    end
+
+    c.Include:append('plx_xcp.h')
+    c.Declarations:append('PLX_XCP_Handle_t XcpHandles[%i];' %
+                              {static.numInstances})
+    c.Declarations:append('PLX_XCP_Obj_t XcpObj[%i];' % {static.numInstances})
+
+    local code = [[
+    {
+      PLX_XCP_sinit();
+      int i;
+      for(i=0; i<%d; i++)
+      {
+        XcpHandles[i] = PLX_XCP_init(&XcpObj[i], sizeof(XcpObj[i]));
+      }
+    }]]
+    c.PreInitCode:append(code % {static.numInstances})
+
+    for _, bid in pairs(static.instances) do
+      local xcp = globals.instances[bid]
+      local c = xcp:finalizeThis(c)
+      if type(c) == 'string' then
+        return c
+      end
+    end
+
+    -- DAQ sampling and calibration updates at the end of each task
+    c.Declarations:append('static void XcpTaskEnd(uint16_t aTaskId, bool aTasksIdle){')
+    c.Declarations:append('  int i;')
+    c.Declarations:append('  for(i=0; i<%i; i++){' % {static.numInstances})
+    c.Declarations:append('    PLX_XCP_taskEnd(XcpHandles[i], aTaskId, aTasksIdle);')
+    c.Declarations:append('  }')
+    c.Declarations:append('}')
+    c.PostInitCode:append('DISPR_registerTaskEndCallback(&XcpTaskEnd);')
+
+    static.finalized = true
+    return c
+  end
+
+  return Xcp
+end
+
+return Module